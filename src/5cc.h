@@ -8,11 +8,51 @@
 #include <stdint.h>
 
 typedef enum {
-    TK_RESERVED,
     TK_NUM,
     TK_IDENT,
     TK_STR,
     TK_EOF,
+
+    // punctuators
+    TK_LE,         // <=
+    TK_GE,         // >=
+    TK_EQ,         // ==
+    TK_NE,         // !=
+    TK_ARROW,      // ->
+    TK_MINUS,      // -
+    TK_PLUS,       // +
+    TK_SLASH,      // /
+    TK_STAR,       // *
+    TK_PERCENT,    // %
+    TK_LT,         // <
+    TK_GT,         // >
+    TK_LPAREN,     // (
+    TK_RPAREN,     // )
+    TK_SEMICOLON,  // ;
+    TK_ASSIGN,     // =
+    TK_LBRACE,     // {
+    TK_RBRACE,     // }
+    TK_AMP,        // &
+    TK_COMMA,      // ,
+    TK_LBRACKET,   // [
+    TK_RBRACKET,   // ]
+    TK_DOT,        // .
+
+    // keywords
+    TK_RETURN,
+    TK_WHILE,
+    TK_ELSE,
+    TK_FOR,
+    TK_SIZEOF,
+    TK_SHORT,
+    TK_CHAR,
+    TK_INT,
+    TK_STRUCT,
+    TK_UNION,
+    TK_LONG,
+    TK_IF,
+    TK_TYPEDEF,
+    TK_VOID,
 } TokenKind;
 
 typedef enum {
@@ -24,6 +64,7 @@ typedef enum {
     ND_NUM,
     ND_AND,
     ND_MOD,
+    ND_SHL,
     ND_EQ, // ==
     ND_NE, // !=
     ND_LT, // <
@@ -56,29 +97,72 @@ typedef enum {
     TY_UNION
 } TypeKind;
 
+typedef enum {
+    IN_INSN,
+    IN_LABEL,
+    IN_DIRECTIVE,
+} InsnKind;
+
+typedef enum {
+    IR_IMM,    // val
+    IR_PARAM,  // val'th argument
+    IR_ADDR,   // &var
+    IR_LOAD,   // *args[0]
+    IR_STORE,  // *args[0] = args[1]
+    IR_EXT,    // args[0] sign-extended from type
+    IR_NEG,
+    IR_ADD,
+    IR_SUB,
+    IR_MUL,
+    IR_DIV,
+    IR_MOD,
+    IR_AND,
+    IR_SHL,
+    IR_EQ,
+    IR_NE,
+    IR_LT,
+    IR_LE,
+    IR_CALL,   // fn_name(args...)
+    IR_PHI,    // args[i] comes from block->preds[i]
+    IR_JMP,    // goto then
+    IR_BR,     // if (args[0]) goto then; else goto els
+    IR_RET,    // return args[0], if any
+} IrOp;
+
 typedef struct Token Token;
 typedef struct Node Node;
 typedef struct Obj Obj;
 typedef struct Type Type;
+typedef struct Insn Insn;
+typedef struct Arena Arena;
+typedef struct IrInsn IrInsn;
+typedef struct IrBlock IrBlock;
+typedef struct IrFunc IrFunc;
+typedef struct IrDef IrDef;
 
+// Tokenize returns all tokens in one array ending with TK_EOF, so the
+// token after tok is tok + 1. The text is found by its offset in
+// UserInput, the values of number and string literals are kept in a
+// separate table and identifiers are interned.
 struct Token {
     TokenKind kind;
-    Token *next;
-    char *loc;
+    int offset;
     int len;
-
-    int64_t val;
-    char *string;
+    int lit;  // index of a literal's value, or an identifier's ID
 };
 
 struct Obj {
     Obj *next;
-    char *name;
+    char *name;  // interned if it comes from the source
     Type *type;
 
     // for Lvar
     bool is_lvar;
     int offset;
+    bool is_escaped;
+    bool is_reg;
+    int reg;
+    int use_count;
     
     // for Fn
     bool is_func;
@@ -87,6 +171,7 @@ struct Obj {
     Obj *params;
     Node *body;
     int stack_size;
+    Arena *arena;  // holds the body and locals
 
     char *init_data;
 
@@ -109,12 +194,14 @@ struct Node {
     Node *init;
     Node *inc;
 
-    int val;
+    int64_t val;
 
     Obj *var;
     Node *body;
-    char *fn_name;
+    char *fn_name;     // interned
     Node *args;
+    Type *func_type;   // type of the callee if it has been declared
+    Obj *ret_buffer;   // where a returned struct or union is stored
 
     Obj *member;
 };
@@ -135,10 +222,79 @@ struct Type {
     Type *next;
 };
 
+// A line of assembly buffered by codegen. op is the mnemonic, the label
+// name or the whole directive; operands are in AT&T order.
+struct Insn {
+    InsnKind kind;
+    Insn *next;
+    char *op;
+    char *ops[2];
+    int nops;
+};
+
+// Mid-level IR. Each function is a list of basic blocks ending in a jump,
+// branch or return. Every value is defined by exactly one instruction and
+// operands point to their defining instruction; locals whose address is
+// never taken are SSA values joined by phis, the others live in memory and
+// are accessed through IR_ADDR, IR_LOAD and IR_STORE.
+struct IrInsn {
+    IrOp op;
+    IrInsn *next;
+    IrBlock *block;
+    int id;        // value number, 0 if no value is defined
+
+    IrInsn **args;
+    int nargs;
+
+    int64_t val;
+    bool wide;     // 64-bit arithmetic
+    Type *type;    // type accessed by IR_LOAD, IR_STORE and IR_EXT
+    Obj *var;
+    char *fn_name;
+
+    IrBlock *then;
+    IrBlock *els;
+
+    IrInsn *replace;  // set if a trivial phi has been removed
+};
+
+struct IrBlock {
+    IrBlock *next;
+    int id;
+    IrInsn *insns;
+    IrInsn *last;
+
+    IrBlock **preds;
+    int npreds;
+
+    // for SSA construction
+    bool sealed;
+    IrDef *defs;
+    IrDef *incomplete;
+};
+
+struct IrFunc {
+    Obj *fn;
+    IrBlock *blocks;
+    int nvalues;
+};
 
 Token *Tokenize(char *p);
+char *TokenLoc(Token *tok);
+char *TokenSpelling(TokenKind kind);
+int64_t TokenVal(Token *tok);
+char *TokenStr(Token *tok);
 Obj *ParseToken(Token *tok);
+void Optimize(Obj *prog);
+bool IsNodePure(Node *node);
+void MarkEscapedLVars(Obj *fn);
+IrFunc *GenIR(Obj *fn);
+bool NeedsFullABI(Obj *fn);
 void GenCode(Obj *prog, FILE *out);
+Insn *ParseInsn(char *line);
+void Peephole(Insn **insns);
+void Assemble(Insn *insns);
+void WriteObj(FILE *out);
 
 void AddType(Node *node);
 bool IsTypeInteger(Type *ty);
@@ -154,14 +310,28 @@ extern Type *ty_void;
 
 extern char *UserInput;
 extern char *InputPath;
+extern bool OptStackMachine;
+extern bool OptIR;
+extern bool OptNoInline;
+extern bool OptEmitObj;
 bool IsStrSame(char *A, char *B);
+Arena *NewArena(void);
+void FreeArena(Arena *arena);
+void *Alloc(size_t size);
+void *FnAlloc(size_t size);
+char *StrNDup(char *s, size_t len);
+int InternIdent(char *name, int len);
+char *IdentName(int id);
+unsigned IdentHash(int id);
+extern Arena *FnArena;
 // void println(char *fmt, ...);
-void Error(char *fmt, ...);
-void ErrorAt(char *loc, char *fmt, ...);
-void ErrorToken(Token *tok, char *fmt, ...);
+void Error(char *fmt, ...) __attribute__((noreturn));
+void ErrorAt(char *loc, char *fmt, ...) __attribute__((noreturn));
+void ErrorToken(Token *tok, char *fmt, ...) __attribute__((noreturn));
 void Debug(char *fmt, ...);
 void PrintToken(Token *tok);
 void PrintObjFn(Obj *obj);
+void PrintIR(IrFunc *ir);
 
 int align_to(int n, int align);
 
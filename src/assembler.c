@@ -0,0 +1,675 @@
+#include <elf.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "5cc.h"
+
+// Encodes the instructions codegen produces into x86-64 machine code and
+// writes them out as a relocatable ELF object, so that no assembler needs
+// to be run. Only the forms codegen emits are supported.
+
+//===================================================================
+// Sections and symbols
+//===================================================================
+typedef struct {
+    uint8_t *data;
+    int len;
+    int cap;
+    int index;  // in the section header table
+} Section;
+
+typedef struct Symbol Symbol;
+struct Symbol {
+    Symbol *next;
+    char *name;
+    Section *sec;  // NULL if undefined
+    int offset;
+    bool is_global;
+    bool is_used;  // referenced by a relocation
+    int index;     // in .symtab
+};
+
+// A 32-bit pc-relative reference to a symbol. Those to local labels of the
+// same section are resolved once everything has been assembled; the others
+// become relocations.
+typedef struct Fixup Fixup;
+struct Fixup {
+    Fixup *next;
+    Section *sec;
+    int offset;
+    Symbol *sym;
+    int64_t addend;
+    int type;
+};
+
+static Section text = {.index = 1};
+static Section data = {.index = 2};
+static Section *cur_sec = &text;
+
+#define NUM_SYMBOL_BUCKETS 1024
+static Symbol *symbols[NUM_SYMBOL_BUCKETS];
+static Fixup *fixups;
+
+static Symbol *find_symbol(char *name) {
+    unsigned h = 0;
+    for (char *p = name; *p; p++)
+        h = h * 31 + *p;
+    Symbol **bucket = &symbols[h % NUM_SYMBOL_BUCKETS];
+    for (Symbol *sym = *bucket; sym; sym = sym->next)
+        if (!strcmp(sym->name, name))
+            return sym;
+
+    Symbol *sym = Alloc(sizeof(Symbol));
+    sym->name = StrNDup(name, strlen(name));
+    sym->next = *bucket;
+    *bucket = sym;
+    return sym;
+}
+
+static void emit8(int byte) {
+    Section *sec = cur_sec;
+    if (sec->len == sec->cap) {
+        sec->cap = sec->cap ? sec->cap * 2 : 4096;
+        sec->data = realloc(sec->data, sec->cap);
+    }
+    sec->data[sec->len++] = byte;
+}
+
+static void emit32(uint32_t val) {
+    for (int i = 0; i < 4; i++)
+        emit8(val >> (i * 8));
+}
+
+static void emit64(uint64_t val) {
+    for (int i = 0; i < 8; i++)
+        emit8(val >> (i * 8));
+}
+
+// Emits a 32-bit field that will hold sym + addend - (address of the field).
+static void emit_fixup(Symbol *sym, int64_t addend, int type) {
+    Fixup *fix = Alloc(sizeof(Fixup));
+    fix->sec = cur_sec;
+    fix->offset = cur_sec->len;
+    fix->sym = sym;
+    fix->addend = addend;
+    fix->type = type;
+    fix->next = fixups;
+    fixups = fix;
+    emit32(0);
+}
+
+//===================================================================
+// Operands
+//===================================================================
+typedef enum {
+    OP_REG,
+    OP_XMM,
+    OP_IMM,
+    OP_MEM,
+} OperandKind;
+
+typedef struct {
+    OperandKind kind;
+    int reg;      // register number, or the base of a memory operand
+    int size;     // of a register
+    int index;    // of a memory operand, -1 if none
+    int scale;
+    int64_t val;  // immediate or displacement
+    Symbol *sym;  // for sym(%rip), whose base is -1
+} Operand;
+
+static struct {
+    char *name;
+    int size;
+} reg_names[] = {
+    {"rax", 8}, {"rcx", 8}, {"rdx", 8}, {"rbx", 8}, {"rsp", 8}, {"rbp", 8}, {"rsi", 8}, {"rdi", 8},
+    {"eax", 4}, {"ecx", 4}, {"edx", 4}, {"ebx", 4}, {"esp", 4}, {"ebp", 4}, {"esi", 4}, {"edi", 4},
+    {"ax", 2},  {"cx", 2},  {"dx", 2},  {"bx", 2},  {"sp", 2},  {"bp", 2},  {"si", 2},  {"di", 2},
+    {"al", 1},  {"cl", 1},  {"dl", 1},  {"bl", 1},  {"spl", 1}, {"bpl", 1}, {"sil", 1}, {"dil", 1},
+};
+
+// Returns the number of a register such as "%r12d" and sets *size.
+static int parse_reg(char *name, int *size) {
+    name++;
+    if (name[0] == 'r' && name[1] >= '0' && name[1] <= '9') {
+        char *end;
+        int num = strtol(name + 1, &end, 10);
+        *size = !*end ? 8 : !strcmp(end, "d") ? 4 : !strcmp(end, "w") ? 2 : 1;
+        return num;
+    }
+    for (int i = 0; i < sizeof(reg_names) / sizeof(*reg_names); i++) {
+        if (!strcmp(name, reg_names[i].name)) {
+            *size = reg_names[i].size;
+            return i % 8;
+        }
+    }
+    Error("unknown register: %%%s", name);
+}
+
+static Operand parse_operand(char *s) {
+    Operand op = {.index = -1, .scale = 1};
+    if (!strcmp(s, "%xmm0")) {
+        op.kind = OP_XMM;
+        return op;
+    }
+    if (s[0] == '%') {
+        op.kind = OP_REG;
+        op.reg = parse_reg(s, &op.size);
+        return op;
+    }
+    if (s[0] == '$') {
+        op.kind = OP_IMM;
+        op.val = strtoll(s + 1, NULL, 10);
+        return op;
+    }
+
+    // [disp | sym[+disp]](base[,index,scale])
+    op.kind = OP_MEM;
+    char *p = s;
+    if (*p != '(' && *p != '-' && (*p < '0' || *p > '9')) {
+        char *q = p;
+        while (*q != '+' && *q != '(')
+            q++;
+        char *name = strndup(p, q - p);
+        op.sym = find_symbol(name);
+        free(name);
+        p = q;
+    }
+    if (*p != '(')
+        op.val = strtoll(p, &p, 10);
+    if (*p++ != '(')
+        Error("invalid operand: %s", s);
+
+    char buf[8];
+    int n = strcspn(p, ",)");
+    snprintf(buf, sizeof(buf), "%.*s", n, p);
+    p += n;
+    if (!strcmp(buf, "%rip")) {
+        op.reg = -1;
+    } else {
+        int size;
+        op.reg = parse_reg(buf, &size);
+    }
+    if (*p == ',') {
+        p++;
+        n = strcspn(p, ",");
+        snprintf(buf, sizeof(buf), "%.*s", n, p);
+        int size;
+        op.index = parse_reg(buf, &size);
+        op.scale = strtol(p + n + 1, NULL, 10);
+    }
+    return op;
+}
+
+//===================================================================
+// Instruction encoding
+//===================================================================
+static bool needs_rex_for_byte(Operand *op) {
+    return op && op->kind == OP_REG && op->size == 1 && op->reg >= 4 && op->reg < 8;
+}
+
+// Emits the ModRM byte and what follows it for rm, with reg in the reg
+// field. imm_size bytes of immediate follow, which a %rip-relative
+// displacement has to account for.
+static void emit_modrm(int reg, Operand *rm, int imm_size) {
+    reg &= 7;
+    if (rm->kind != OP_MEM) {
+        emit8(0xC0 | reg << 3 | (rm->reg & 7));
+        return;
+    }
+    if (rm->reg < 0) {
+        emit8(reg << 3 | 5);
+        emit_fixup(rm->sym, rm->val - 4 - imm_size, R_X86_64_PC32);
+        return;
+    }
+
+    int base = rm->reg & 7;
+    int mod = 2;
+    if (rm->val == 0 && base != 5)
+        mod = 0;
+    else if (rm->val == (int8_t)rm->val)
+        mod = 1;
+
+    if (rm->index >= 0 || base == 4) {
+        int scale = rm->scale == 8 ? 3 : rm->scale == 4 ? 2 : rm->scale == 2 ? 1 : 0;
+        int index = rm->index >= 0 ? rm->index & 7 : 4;
+        emit8(mod << 6 | reg << 3 | 4);
+        emit8(scale << 6 | index << 3 | base);
+    } else {
+        emit8(mod << 6 | reg << 3 | base);
+    }
+    if (mod == 1)
+        emit8(rm->val);
+    else if (mod == 2)
+        emit32(rm->val);
+}
+
+// Emits [prefix] [REX] opcode ModRM... The reg field holds the register
+// reg if given and the opcode extension digit otherwise. An opcode of more
+// than one byte is given most significant byte first.
+static void emit_op(int prefix, bool w, int opcode, Operand *reg, int digit, Operand *rm, int imm_size) {
+    if (prefix)
+        emit8(prefix);
+
+    int r = reg ? reg->reg : digit;
+    int rex = 0x40 | w << 3 | (r >> 3 & 1) << 2;
+    if (rm->kind == OP_MEM) {
+        rex |= (rm->index >= 0 ? rm->index >> 3 & 1 : 0) << 1;
+        rex |= rm->reg >= 0 ? rm->reg >> 3 & 1 : 0;
+    } else {
+        rex |= rm->reg >> 3 & 1;
+    }
+    if (rex != 0x40 || needs_rex_for_byte(reg) || needs_rex_for_byte(rm))
+        emit8(rex);
+
+    if (opcode > 0xFFFF)
+        emit8(opcode >> 16);
+    if (opcode > 0xFF)
+        emit8(opcode >> 8);
+    emit8(opcode);
+    emit_modrm(r, rm, imm_size);
+}
+
+static int op_size(Operand *op1, Operand *op2) {
+    if (op1->kind == OP_REG)
+        return op1->size;
+    if (op2 && op2->kind == OP_REG)
+        return op2->size;
+    Error("operand size unknown");
+}
+
+static int size_prefix(int size) {
+    return size == 2 ? 0x66 : 0;
+}
+
+static void emit_imm(int64_t val, int size) {
+    if (size == 1)
+        emit8(val);
+    else
+        emit32(val);
+}
+
+// add, or, and, sub and cmp share their encodings, differing only in n.
+static void asm_alu(int n, Operand *src, Operand *dst) {
+    int size = op_size(dst, src);
+    bool w = size == 8;
+    if (src->kind == OP_IMM) {
+        int imm_size = src->val == (int8_t)src->val ? 1 : 4;
+        emit_op(size_prefix(size), w, imm_size == 1 ? 0x83 : 0x81, NULL, n, dst, imm_size);
+        emit_imm(src->val, imm_size);
+    } else if (src->kind == OP_REG) {
+        emit_op(size_prefix(size), w, n * 8 + (size == 1 ? 0 : 1), src, 0, dst, 0);
+    } else {
+        emit_op(size_prefix(size), w, n * 8 + (size == 1 ? 2 : 3), dst, 0, src, 0);
+    }
+}
+
+static void asm_mov(Operand *src, Operand *dst) {
+    if (src->kind == OP_XMM || dst->kind == OP_XMM) {
+        // movdqu
+        if (dst->kind == OP_XMM)
+            emit_op(0xF3, false, 0x0F6F, dst, 0, src, 0);
+        else
+            emit_op(0xF3, false, 0x0F7F, src, 0, dst, 0);
+        return;
+    }
+
+    int size = op_size(dst, src);
+    if (src->kind == OP_IMM) {
+        if (dst->kind == OP_REG && size == 8 && src->val != (int32_t)src->val) {
+            emit8(0x48 | (dst->reg >> 3 & 1));
+            emit8(0xB8 + (dst->reg & 7));
+            emit64(src->val);
+            return;
+        }
+        if (size == 1)
+            Error("unsupported operand size");
+        emit_op(size_prefix(size), size == 8, 0xC7, NULL, 0, dst, size == 2 ? 2 : 4);
+        if (size == 2) {
+            emit8(src->val);
+            emit8(src->val >> 8);
+        } else {
+            emit32(src->val);
+        }
+        return;
+    }
+    if (src->kind == OP_REG)
+        emit_op(size_prefix(size), size == 8, size == 1 ? 0x88 : 0x89, src, 0, dst, 0);
+    else
+        emit_op(size_prefix(size), size == 8, size == 1 ? 0x8A : 0x8B, dst, 0, src, 0);
+}
+
+static int cond_code(char *cc) {
+    static struct {
+        char *name;
+        int code;
+    } table[] = {
+        {"e", 0x4}, {"ne", 0x5}, {"l", 0xC}, {"ge", 0xD}, {"le", 0xE}, {"g", 0xF},
+    };
+    for (int i = 0; i < sizeof(table) / sizeof(*table); i++)
+        if (!strcmp(cc, table[i].name))
+            return table[i].code;
+    return -1;
+}
+
+// Jumps and calls always take a 32-bit displacement. Calls and jumps to
+// other functions go through the PLT so that the linker may redirect them.
+static void asm_branch(int opcode, char *target) {
+    if (opcode > 0xFF)
+        emit8(opcode >> 8);
+    emit8(opcode);
+    Symbol *sym = find_symbol(target);
+    emit_fixup(sym, -4, strncmp(target, ".L", 2) ? R_X86_64_PLT32 : R_X86_64_PC32);
+}
+
+static void asm_insn(Insn *insn) {
+    char *op = insn->op;
+    if (!strcmp(op, "jmp")) {
+        asm_branch(0xE9, insn->ops[0]);
+        return;
+    }
+    if (!strcmp(op, "call")) {
+        asm_branch(0xE8, insn->ops[0]);
+        return;
+    }
+    if (op[0] == 'j' && cond_code(op + 1) >= 0) {
+        asm_branch(0x0F80 | cond_code(op + 1), insn->ops[0]);
+        return;
+    }
+
+    Operand a = {}, b = {};
+    if (insn->nops > 0 && strcmp(op, "rep"))
+        a = parse_operand(insn->ops[0]);
+    if (insn->nops > 1)
+        b = parse_operand(insn->ops[1]);
+
+    static struct {
+        char *name;
+        int n;
+    } alu[] = {{"add", 0}, {"or", 1}, {"and", 4}, {"sub", 5}, {"cmp", 7}};
+    for (int i = 0; i < sizeof(alu) / sizeof(*alu); i++) {
+        if (!strcmp(op, alu[i].name)) {
+            asm_alu(alu[i].n, &a, &b);
+            return;
+        }
+    }
+
+    static struct {
+        char *name;
+        int n;
+    } shift[] = {{"shl", 4}, {"shr", 5}, {"sar", 7}};
+    for (int i = 0; i < sizeof(shift) / sizeof(*shift); i++) {
+        if (!strcmp(op, shift[i].name)) {
+            bool w = b.size == 8;
+            if (a.kind == OP_IMM) {
+                emit_op(0, w, 0xC1, NULL, shift[i].n, &b, 1);
+                emit8(a.val);
+            } else {
+                emit_op(0, w, 0xD3, NULL, shift[i].n, &b, 0);
+            }
+            return;
+        }
+    }
+
+    if (!strcmp(op, "mov") || !strcmp(op, "movdqu")) {
+        asm_mov(&a, &b);
+    } else if (!strcmp(op, "movsbq")) {
+        emit_op(0, true, 0x0FBE, &b, 0, &a, 0);
+    } else if (!strcmp(op, "movswq")) {
+        emit_op(0, true, 0x0FBF, &b, 0, &a, 0);
+    } else if (!strcmp(op, "movsxd")) {
+        emit_op(0, true, 0x63, &b, 0, &a, 0);
+    } else if (!strcmp(op, "movzb") || !strcmp(op, "movzbl")) {
+        emit_op(0, b.size == 8, 0x0FB6, &b, 0, &a, 0);
+    } else if (!strcmp(op, "movzwl")) {
+        emit_op(0, false, 0x0FB7, &b, 0, &a, 0);
+    } else if (!strcmp(op, "lea")) {
+        emit_op(0, true, 0x8D, &b, 0, &a, 0);
+    } else if (!strcmp(op, "push") || !strcmp(op, "pop")) {
+        if (a.reg >= 8)
+            emit8(0x41);
+        emit8((!strcmp(op, "push") ? 0x50 : 0x58) + (a.reg & 7));
+    } else if (!strcmp(op, "imul")) {
+        bool w = b.size == 8;
+        if (a.kind == OP_IMM) {
+            int imm_size = a.val == (int8_t)a.val ? 1 : 4;
+            emit_op(0, w, imm_size == 1 ? 0x6B : 0x69, &b, 0, &b, imm_size);
+            emit_imm(a.val, imm_size);
+        } else {
+            emit_op(0, w, 0x0FAF, &b, 0, &a, 0);
+        }
+    } else if (!strcmp(op, "idiv")) {
+        emit_op(0, op_size(&a, NULL) == 8, 0xF7, NULL, 7, &a, 0);
+    } else if (!strcmp(op, "neg")) {
+        emit_op(0, op_size(&a, NULL) == 8, 0xF7, NULL, 3, &a, 0);
+    } else if (!strcmp(op, "cqo")) {
+        emit8(0x48);
+        emit8(0x99);
+    } else if (!strcmp(op, "cdq")) {
+        emit8(0x99);
+    } else if (!strcmp(op, "ret")) {
+        emit8(0xC3);
+    } else if (!strcmp(op, "rep")) {
+        // rep movsb
+        emit8(0xF3);
+        emit8(0xA4);
+    } else if (!strncmp(op, "set", 3) && cond_code(op + 3) >= 0) {
+        emit_op(0, false, 0x0F90 | cond_code(op + 3), NULL, 0, &a, 0);
+    } else {
+        Error("unknown instruction: %s", op);
+    }
+}
+
+static void asm_directive(char *line) {
+    while (*line == ' ' || *line == '\t')
+        line++;
+    char *arg = strchr(line, ' ');
+    if (arg)
+        arg++;
+
+    if (!strcmp(line, ".text"))
+        cur_sec = &text;
+    else if (!strcmp(line, ".data"))
+        cur_sec = &data;
+    else if (!strncmp(line, ".globl ", 7) || !strncmp(line, ".global ", 8))
+        find_symbol(arg)->is_global = true;
+    else if (!strncmp(line, ".byte ", 6))
+        emit8(atoi(arg));
+    else if (!strncmp(line, ".zero ", 6))
+        for (int i = atoi(arg); i > 0; i--)
+            emit8(0);
+    else
+        Error("unknown directive: %s", line);
+}
+
+void Assemble(Insn *insn) {
+    for (; insn; insn = insn->next) {
+        switch (insn->kind) {
+        case IN_LABEL: {
+            Symbol *sym = find_symbol(insn->op);
+            if (sym->sec)
+                Error("symbol redefined: %s", insn->op);
+            sym->sec = cur_sec;
+            sym->offset = cur_sec->len;
+            continue;
+        }
+        case IN_DIRECTIVE:
+            asm_directive(insn->op);
+            continue;
+        case IN_INSN:
+            asm_insn(insn);
+            continue;
+        }
+    }
+}
+
+//===================================================================
+// ELF output
+//===================================================================
+typedef struct {
+    char *data;
+    size_t len;
+    FILE *fp;
+} StrTab;
+
+static int add_string(StrTab *tab, char *s) {
+    fflush(tab->fp);
+    int offset = tab->len;
+    fwrite(s, 1, strlen(s) + 1, tab->fp);
+    return offset;
+}
+
+static void open_strtab(StrTab *tab) {
+    tab->fp = open_memstream(&tab->data, &tab->len);
+    fputc('\0', tab->fp);
+}
+
+static void close_strtab(StrTab *tab) {
+    fclose(tab->fp);
+}
+
+static bool is_local_label(Fixup *fix) {
+    return !fix->sym->is_global && fix->sym->sec == fix->sec;
+}
+
+// Patches references to local labels and returns the relocations for the
+// rest, in .text order.
+static Elf64_Rela *resolve_fixups(int *nrelas) {
+    int n = 0;
+    for (Fixup *fix = fixups; fix; fix = fix->next)
+        if (!is_local_label(fix))
+            n++;
+
+    Elf64_Rela *relas = calloc(n + 1, sizeof(Elf64_Rela));
+    int i = n;
+    for (Fixup *fix = fixups; fix; fix = fix->next) {
+        if (is_local_label(fix)) {
+            int32_t val = fix->sym->offset + fix->addend - fix->offset;
+            memcpy(fix->sec->data + fix->offset, &val, 4);
+            continue;
+        }
+        if (fix->sec != &text)
+            Error("relocation outside of .text");
+        fix->sym->is_used = true;
+        Elf64_Rela *rela = &relas[--i];
+        rela->r_offset = fix->offset;
+        rela->r_info = (uint64_t)fix->type;  // symbol index filled in later
+        rela->r_addend = fix->addend;
+    }
+    *nrelas = n;
+    return relas;
+}
+
+static void pad_to(FILE *out, long *pos, int align) {
+    while (*pos % align) {
+        fputc(0, out);
+        (*pos)++;
+    }
+}
+
+static bool is_global_sym(Symbol *sym) {
+    return sym->is_global || !sym->sec;
+}
+
+// Local labels only get an entry if a relocation refers to them.
+static bool has_entry(Symbol *sym) {
+    return sym->is_used || (sym->is_global && sym->sec);
+}
+
+void WriteObj(FILE *out) {
+    int nrelas;
+    Elf64_Rela *relas = resolve_fixups(&nrelas);
+
+    // Local symbols must precede global ones.
+    int nsyms = 1;
+    int first_global = 0;
+    for (int global = 0; global < 2; global++) {
+        if (global)
+            first_global = nsyms;
+        for (int i = 0; i < NUM_SYMBOL_BUCKETS; i++)
+            for (Symbol *sym = symbols[i]; sym; sym = sym->next)
+                if (has_entry(sym) && is_global_sym(sym) == global)
+                    sym->index = nsyms++;
+    }
+
+    StrTab strtab;
+    open_strtab(&strtab);
+    Elf64_Sym *syms = calloc(nsyms, sizeof(Elf64_Sym));
+    for (int i = 0; i < NUM_SYMBOL_BUCKETS; i++) {
+        for (Symbol *sym = symbols[i]; sym; sym = sym->next) {
+            if (!has_entry(sym))
+                continue;
+            Elf64_Sym *esym = &syms[sym->index];
+            int type = sym->sec == &text ? STT_FUNC : sym->sec ? STT_OBJECT : STT_NOTYPE;
+            esym->st_name = add_string(&strtab, sym->name);
+            esym->st_info = ELF64_ST_INFO(is_global_sym(sym) ? STB_GLOBAL : STB_LOCAL, type);
+            esym->st_shndx = sym->sec ? sym->sec->index : SHN_UNDEF;
+            esym->st_value = sym->offset;
+        }
+    }
+    close_strtab(&strtab);
+
+    int r = nrelas;
+    for (Fixup *fix = fixups; fix; fix = fix->next)
+        if (!is_local_label(fix))
+            relas[--r].r_info = ELF64_R_INFO(fix->sym->index, fix->type);
+
+    StrTab shstrtab;
+    open_strtab(&shstrtab);
+    Elf64_Shdr shdrs[8] = {};
+    shdrs[1] = (Elf64_Shdr){.sh_name = add_string(&shstrtab, ".text"), .sh_type = SHT_PROGBITS,
+                            .sh_flags = SHF_ALLOC | SHF_EXECINSTR, .sh_addralign = 16,
+                            .sh_size = text.len};
+    shdrs[2] = (Elf64_Shdr){.sh_name = add_string(&shstrtab, ".data"), .sh_type = SHT_PROGBITS,
+                            .sh_flags = SHF_ALLOC | SHF_WRITE, .sh_addralign = 8,
+                            .sh_size = data.len};
+    shdrs[3] = (Elf64_Shdr){.sh_name = add_string(&shstrtab, ".rela.text"), .sh_type = SHT_RELA,
+                            .sh_flags = SHF_INFO_LINK, .sh_link = 4, .sh_info = 1,
+                            .sh_addralign = 8, .sh_entsize = sizeof(Elf64_Rela),
+                            .sh_size = nrelas * sizeof(Elf64_Rela)};
+    shdrs[4] = (Elf64_Shdr){.sh_name = add_string(&shstrtab, ".symtab"), .sh_type = SHT_SYMTAB,
+                            .sh_link = 5, .sh_info = first_global, .sh_addralign = 8,
+                            .sh_entsize = sizeof(Elf64_Sym), .sh_size = nsyms * sizeof(Elf64_Sym)};
+    shdrs[5] = (Elf64_Shdr){.sh_name = add_string(&shstrtab, ".strtab"), .sh_type = SHT_STRTAB,
+                            .sh_addralign = 1, .sh_size = strtab.len};
+    shdrs[6] = (Elf64_Shdr){.sh_name = add_string(&shstrtab, ".shstrtab"), .sh_type = SHT_STRTAB,
+                            .sh_addralign = 1};
+    shdrs[7] = (Elf64_Shdr){.sh_name = add_string(&shstrtab, ".note.GNU-stack"),
+                            .sh_type = SHT_PROGBITS, .sh_addralign = 1};
+    close_strtab(&shstrtab);
+    shdrs[6].sh_size = shstrtab.len;
+
+    // The file is written front to back so that it can go to a pipe.
+    long pos = sizeof(Elf64_Ehdr);
+    for (int i = 1; i < 8; i++) {
+        pos = align_to(pos, shdrs[i].sh_addralign);
+        shdrs[i].sh_offset = pos;
+        pos += shdrs[i].sh_size;
+    }
+
+    Elf64_Ehdr ehdr = {
+        .e_ident = {ELFMAG0, ELFMAG1, ELFMAG2, ELFMAG3, ELFCLASS64, ELFDATA2LSB, EV_CURRENT},
+        .e_type = ET_REL,
+        .e_machine = EM_X86_64,
+        .e_version = EV_CURRENT,
+        .e_shoff = align_to(pos, 8),
+        .e_ehsize = sizeof(Elf64_Ehdr),
+        .e_shentsize = sizeof(Elf64_Shdr),
+        .e_shnum = 8,
+        .e_shstrndx = 6,
+    };
+
+    void *contents[] = {NULL, text.data, data.data, relas, syms, strtab.data, shstrtab.data, NULL};
+    fwrite(&ehdr, 1, sizeof(ehdr), out);
+    pos = sizeof(ehdr);
+    for (int i = 1; i < 8; i++) {
+        pad_to(out, &pos, shdrs[i].sh_addralign);
+        if (shdrs[i].sh_size)
+            fwrite(contents[i], 1, shdrs[i].sh_size, out);
+        pos += shdrs[i].sh_size;
+    }
+    pad_to(out, &pos, 8);
+    fwrite(shdrs, 1, sizeof(shdrs), out);
+}
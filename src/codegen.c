@@ -1,25 +1,167 @@
 #include <assert.h>
 #include <stdio.h>
+#include <string.h>
 
 #include "5cc.h"
 
 static int depth;
 
+// Promoted locals and expression temporaries share the callee-saved
+// registers so that both survive calls. Locals are given registers from the
+// end of the list; temporaries use the rest as a stack and spill to the
+// machine stack once it is full.
+static char *calleereg32[] = {"%ebx", "%r12d", "%r13d", "%r14d", "%r15d"};
+static char *calleereg64[] = {"%rbx", "%r12", "%r13", "%r14", "%r15"};
+#define NUM_CALLEEREG (int)(sizeof(calleereg64) / sizeof(*calleereg64))
+#define MAX_REG_LVARS 3
+static int num_tmpreg;
+static bool used_calleereg[NUM_CALLEEREG];
+
 static char *argreg8[] = {"%dil", "%sil", "%dl", "%cl", "%r8b", "%r9b"};
 static char *argreg16[] = {"%di", "%si", "%dx", "%cx", "%r8w", "%r9w"};
 static char *argreg32[] = {"%edi", "%esi", "%edx", "%ecx", "%r8d", "%r9d"};
 static char *argreg64[] = {"%rdi", "%rsi", "%rdx", "%rcx", "%r8", "%r9"};
 
 static Obj *current_fn;
+static Obj *ret_ptr;  // where a function returning a struct in memory keeps %rdi
 static FILE *output_file;
 
+//===================================================================
+// Output buffer
+//===================================================================
+// Assembly is collected here and handed to the OS in large blocks instead
+// of going through stdio line by line.
+static char out_buf[1 << 16];
+static int out_len;
+
+static void flush_out(void) {
+    if (out_len && fwrite(out_buf, 1, out_len, output_file) != (size_t)out_len)
+        Error("cannot write output");
+    out_len = 0;
+}
+
+static void write_out(char *s, int len) {
+    if (out_len + len > (int)sizeof(out_buf)) {
+        flush_out();
+        if (len > (int)sizeof(out_buf)) {
+            if (fwrite(s, 1, len, output_file) != (size_t)len)
+                Error("cannot write output");
+            return;
+        }
+    }
+    memcpy(out_buf + out_len, s, len);
+    out_len += len;
+}
+
+static void write_str(char *s) {
+    write_out(s, strlen(s));
+}
+
+// Writes the decimal form of val to buf and returns its length.
+static int format_int(char *buf, long val) {
+    char tmp[24];
+    unsigned long u = val < 0 ? -(unsigned long)val : val;
+    int n = 0;
+    do {
+        tmp[n++] = '0' + u % 10;
+        u /= 10;
+    } while (u);
+
+    int len = 0;
+    if (val < 0)
+        buf[len++] = '-';
+    while (n)
+        buf[len++] = tmp[--n];
+    return len;
+}
+
+// A printf subset covering what codegen needs: %s, %d, %ld and %%.
+static int format(char *buf, int size, char *fmt, va_list ap) {
+    int len = 0;
+    for (char *p = fmt; *p; p++) {
+        if (len + 24 > size)
+            Error("assembly line too long");
+        if (*p != '%') {
+            buf[len++] = *p;
+            continue;
+        }
+
+        switch (*++p) {
+        case 's': {
+            char *s = va_arg(ap, char *);
+            int n = strlen(s);
+            if (len + n + 24 > size)
+                Error("assembly line too long");
+            memcpy(buf + len, s, n);
+            len += n;
+            continue;
+        }
+        case 'd':
+            len += format_int(buf + len, va_arg(ap, int));
+            continue;
+        case 'l':
+            assert(p[1] == 'd');
+            p++;
+            len += format_int(buf + len, va_arg(ap, long));
+            continue;
+        case '%':
+            buf[len++] = '%';
+            continue;
+        }
+        Error("unsupported format: %s", fmt);
+    }
+    buf[len] = '\0';
+    return len;
+}
+
+// While a function is being generated, its lines are buffered here for the
+// peephole optimizer instead of being written out.
+static Insn **insn_tail;
+
 static void println(char *fmt, ...) {
+    char line[4096];
     va_list ap;
     va_start(ap, fmt);
-    vfprintf(output_file, fmt, ap);
+    int len = format(line, sizeof(line), fmt, ap);
     va_end(ap);
-    fprintf(output_file, "\n");
-    return ;
+
+    if (!insn_tail) {
+        line[len++] = '\n';
+        write_out(line, len);
+        return;
+    }
+    *insn_tail = ParseInsn(line);
+    insn_tail = &(*insn_tail)->next;
+}
+
+// Writes out buffered lines, or encodes them into the object file with
+// -emit-obj.
+static void emit_insns(Insn *insn) {
+    if (OptEmitObj) {
+        Assemble(insn);
+        return;
+    }
+    for (; insn; insn = insn->next) {
+        switch (insn->kind) {
+        case IN_LABEL:
+            write_str(insn->op);
+            write_out(":\n", 2);
+            continue;
+        case IN_DIRECTIVE:
+            write_str(insn->op);
+            write_out("\n", 1);
+            continue;
+        case IN_INSN:
+            write_out("\t", 1);
+            write_str(insn->op);
+            for (int i = 0; i < insn->nops; i++) {
+                write_out(i ? ", " : " ", i ? 2 : 1);
+                write_str(insn->ops[i]);
+            }
+            write_out("\n", 1);
+            continue;
+        }
+    }
 }
 
 static void comment(char *msg) {
@@ -27,14 +169,36 @@ static void comment(char *msg) {
     println(msg);
 }
 
+static bool is_tmpreg(int d) {
+    return !OptStackMachine && d < num_tmpreg;
+}
+
 static void push(void) {
-  println("\tpush %%rax");
-  depth++;
+    if (is_tmpreg(depth)) {
+        println("\tmov %%rax, %s", calleereg64[depth]);
+        used_calleereg[depth] = true;
+    } else {
+        println("\tpush %%rax");
+    }
+    depth++;
 }
 
 static void pop(char *arg) {
-  println("\tpop %s", arg);
-  depth--;
+    depth--;
+    if (is_tmpreg(depth))
+        println("\tmov %s, %s", calleereg64[depth], arg);
+    else
+        println("\tpop %s", arg);
+}
+
+// Pops the top temporary for use as a binary operand. Returns its register
+// index, or -1 if it had been spilled and is now in %rdi.
+static int pop_operand(void) {
+    depth--;
+    if (is_tmpreg(depth))
+        return depth;
+    println("\tpop %%rdi");
+    return -1;
 }
 
 static int count() {
@@ -46,67 +210,661 @@ int align_to(int n, int align) {
     return (n + align - 1) / align * align;
 }
 
-static void load(Type *type) {
-    if (type->kind == TY_ARRAY || type->kind == TY_STRUCT || type->kind == TY_UNION)
+// Loads the value at mem into %rax. Arrays, structs and unions are not
+// loaded; their value is the address itself.
+static void load(Type *type, char *mem) {
+    if (type->kind == TY_ARRAY || type->kind == TY_STRUCT || type->kind == TY_UNION) {
+        if (strcmp(mem, "(%rax)"))
+            println("\tlea %s, %%rax", mem);
         return;
+    }
     if (type->size == 1)
-        println("\tmovsbq (%%rax), %%rax");
+        println("\tmovsbq %s, %%rax", mem);
     else if (type->size == 2)
-        println("\tmovswq (%%rax), %%rax");
+        println("\tmovswq %s, %%rax", mem);
     else if (type->size == 4)
-        println("\tmovsxd (%%rax), %%rax");
+        println("\tmovsxd %s, %%rax", mem);
     else
-        println("\tmov (%%rax), %%rax");
+        println("\tmov %s, %%rax", mem);
     return;
 }
 
-static void store(Type *type) {
-    pop("%rdi");
-    if (type->kind == TY_STRUCT || type->kind == TY_UNION) {
-        for (int i = 0; i < type->size; i++) {
-            println("\tmov %d(%%rax), %%r8b", i);
-            println("\tmov %%r8b, %d(%%rdi)", i);
+static void copy_chunk(int offset, int size) {
+    static char *reg[] = {[1] = "%r8b", [2] = "%r8w", [4] = "%r8d", [8] = "%r8", [16] = "%xmm0"};
+    char *op = size == 16 ? "movdqu" : "mov";
+    println("\t%s %d(%%rax), %s", op, offset, reg[size]);
+    println("\t%s %s, %d(%%rdi)", op, reg[size], offset);
+}
+
+// Copies size bytes from (%rax) to (%rdi). Large blocks use rep movsb.
+// Others are copied 16 bytes at a time, and the remainder by a single
+// move that overlaps bytes already copied if the block is big enough,
+// which x86 allows at any alignment.
+static void copy_block(int size) {
+    if (size > 128) {
+        println("\tmov %%rax, %%rsi");
+        println("\tmov $%d, %%rcx", size);
+        println("\trep movsb");
+        return;
+    }
+
+    int offset = 0;
+    while (offset < size) {
+        int rest = size - offset;
+        int chunk = 16;
+        while (chunk / 2 >= rest)
+            chunk /= 2;
+        if (rest >= chunk) {
+            copy_chunk(offset, chunk);
+            offset += chunk;
+        } else if (chunk <= size) {
+            copy_chunk(size - chunk, chunk);
+            return;
+        } else {
+            copy_chunk(offset, chunk / 2);
+            offset += chunk / 2;
         }
+    }
+}
+
+// Stores %rax to mem. A struct or union in %rax is the address of its
+// value, which gets copied; mem must not use %rdi in that case.
+static void store(Type *type, char *mem) {
+    if (type->kind == TY_STRUCT || type->kind == TY_UNION) {
+        if (strcmp(mem, "(%rdi)"))
+            println("\tlea %s, %%rdi", mem);
+        copy_block(type->size);
         return;
     }
     if (type->size == 1)
-        println("\tmov %%al, (%%rdi)");
+        println("\tmov %%al, %s", mem);
     else if (type->size == 2)
-        println("\tmov %%ax, (%%rdi)");
+        println("\tmov %%ax, %s", mem);
     else if (type->size == 4)
-        println("\tmov %%eax, (%%rdi)");
+        println("\tmov %%eax, %s", mem);
+    else
+        println("\tmov %%rax, %s", mem);
+}
+
+// Register locals always hold their value sign-extended to 64 bits, the
+// same form load() produces for a stack slot.
+static void store_reg(Obj *var) {
+    char *reg = calleereg64[var->reg];
+    if (var->type->size == 1)
+        println("\tmovsbq %%al, %s", reg);
+    else if (var->type->size == 2)
+        println("\tmovswq %%ax, %s", reg);
+    else if (var->type->size == 4)
+        println("\tmovsxd %%eax, %s", reg);
     else
-        println("\tmov %%rax, (%%rdi)");
+        println("\tmov %%rax, %s", reg);
+}
+
+//===================================================================
+// Calling convention
+//===================================================================
+// There are no floating-point types, so everything is passed in the
+// general-purpose registers: scalars in one, structs and unions of up to
+// 16 bytes in one per eightbyte. Larger ones, and anything once the six
+// registers run out, go on the stack.
+static bool is_aggregate(Type *type) {
+    return type->kind == TY_STRUCT || type->kind == TY_UNION;
+}
+
+static bool in_memory(Type *type) {
+    return is_aggregate(type) && type->size > 16;
+}
+
+// Where the next argument goes. gp counts the registers taken so far and
+// stack the bytes of the argument area.
+typedef struct {
+    int gp;
+    int stack;
+} ArgState;
+
+// Returns the first register of an argument of the given type, or -1 if it
+// is passed on the stack, in which case *offset is set to its place in the
+// argument area.
+static int next_arg(ArgState *st, Type *type, int *offset) {
+    int size = is_aggregate(type) ? align_to(type->size, 8) : 8;
+    if (!in_memory(type) && st->gp + size / 8 <= 6) {
+        st->gp += size / 8;
+        return st->gp - size / 8;
+    }
+    *offset = st->stack;
+    st->stack += size;
+    return -1;
+}
+
+static char *sub_reg(char *reg, int size) {
+    static char *table[][4] = {
+        {"%rax", "%eax", "%ax", "%al"},   {"%rdx", "%edx", "%dx", "%dl"},
+        {"%rdi", "%edi", "%di", "%dil"},  {"%rsi", "%esi", "%si", "%sil"},
+        {"%rcx", "%ecx", "%cx", "%cl"},   {"%r8", "%r8d", "%r8w", "%r8b"},
+        {"%r9", "%r9d", "%r9w", "%r9b"},
+    };
+    int i = size == 8 ? 0 : size == 4 ? 1 : size == 2 ? 2 : 3;
+    for (int j = 0; j < sizeof(table) / sizeof(*table); j++)
+        if (!strcmp(table[j][0], reg))
+            return table[j][i];
+    Error("unknown register: %s", reg);
+}
+
+// Loads the size bytes at offset(base) into the low bytes of reg. Sizes
+// other than 1, 2, 4 and 8 are put together a byte at a time so that
+// nothing past the end of the value is read.
+static void load_bytes(char *reg, int size, int offset, char *base) {
+    switch (size) {
+    case 1:
+        println("\tmovzbl %d(%s), %s", offset, base, sub_reg(reg, 4));
+        return;
+    case 2:
+        println("\tmovzwl %d(%s), %s", offset, base, sub_reg(reg, 4));
+        return;
+    case 4:
+    case 8:
+        println("\tmov %d(%s), %s", offset, base, sub_reg(reg, size));
+        return;
+    }
+    println("\tmov $0, %s", reg);
+    for (int i = size - 1; i >= 0; i--) {
+        println("\tshl $8, %s", reg);
+        println("\tmovzbl %d(%s), %%r11d", offset + i, base);
+        println("\tor %%r11, %s", reg);
+    }
+}
+
+// Stores the low size bytes of reg to offset(base), shifting reg out if
+// the size is odd.
+static void store_bytes(char *reg, int size, int offset, char *base) {
+    if (size == 1 || size == 2 || size == 4 || size == 8) {
+        println("\tmov %s, %d(%s)", sub_reg(reg, size), offset, base);
+        return;
+    }
+    for (int i = 0; i < size; i++) {
+        println("\tmov %s, %d(%s)", sub_reg(reg, 1), offset + i, base);
+        println("\tshr $8, %s", reg);
+    }
+}
+
+// Loads a struct or union of up to 16 bytes at offset(base) into reg and,
+// past 8 bytes, reg2.
+static void load_aggregate(Type *type, char *reg, char *reg2, char *base) {
+    load_bytes(reg, type->size < 8 ? type->size : 8, 0, base);
+    if (type->size > 8)
+        load_bytes(reg2, type->size - 8, 8, base);
+}
+
+static void store_aggregate(Type *type, char *reg, char *reg2, int offset, char *base) {
+    store_bytes(reg, type->size < 8 ? type->size : 8, offset, base);
+    if (type->size > 8)
+        store_bytes(reg2, type->size - 8, offset + 8, base);
 }
 
 static void gen_stmt(Node *node);
 static void gen_expr(Node *node);
+static void gen_addr(Node *node);
+static bool gen_index(Node *node, char *buf);
 
-static void gen_addr(Node *node) {
+static char *var_mem(Obj *var, int offset, char *buf) {
+    if (var->is_lvar)
+        sprintf(buf, "%d(%%rbp)", var->offset + offset);
+    else if (offset)
+        sprintf(buf, "%s+%d(%%rip)", var->name, offset);
+    else
+        sprintf(buf, "%s(%%rip)", var->name);
+    return buf;
+}
+
+// True if the address of node is a constant offset from %rbp or %rip, so
+// that it can be used as a memory operand without computing it first.
+static bool is_static_mem(Node *node) {
+    if (node->kind == ND_DOTS)
+        return is_static_mem(node->lhs);
+    return node->kind == ND_VAR && !node->var->is_reg;
+}
+
+// Binary operators compute in 64 bits if the left operand is a long or a
+// pointer and in 32 bits otherwise.
+static bool is_wide(Type *type) {
+    return type->kind == TY_LONG || type->base;
+}
+
+// Writes the source operand for an instruction to buf if node can be used
+// as one without being evaluated into a register first: a register local,
+// or (if imm_mem is set) a constant or a stack or global scalar of the
+// right size.
+static bool direct_operand(Node *node, bool wide, bool imm_mem, char *buf) {
+    if (node->kind == ND_NUM) {
+        if (!imm_mem || node->val != (int32_t)node->val)
+            return false;
+        sprintf(buf, "$%ld", node->val);
+        return true;
+    }
+    if (node->kind != ND_VAR)
+        return false;
+
+    Obj *var = node->var;
+    if (var->is_reg) {
+        strcpy(buf, wide ? calleereg64[var->reg] : calleereg32[var->reg]);
+        return true;
+    }
+    if (!imm_mem || (!IsTypeInteger(var->type) && var->type->kind != TY_PTR))
+        return false;
+    if (var->type->size != 8 && (wide || var->type->size != 4))
+        return false;
+    var_mem(var, 0, buf);
+    return true;
+}
+
+static bool is_binary(Node *node) {
     switch (node->kind) {
-    case ND_VAR:
-        if (node->var->is_lvar) {
-            println("\tlea %d(%%rbp), %%rax", node->var->offset);
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_MOD:
+    case ND_AND:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+        return true;
+    }
+    return false;
+}
+
+// Estimates how many temporaries evaluating node takes (its Sethi-Ullman
+// number), so that the operand needing more is evaluated first.
+static int reg_need(Node *node) {
+    if (!node)
+        return 0;
+
+    char buf[64];
+    if (is_binary(node)) {
+        int l = reg_need(node->lhs);
+        if (direct_operand(node->rhs, is_wide(node->lhs->type), true, buf))
+            return l;
+        int r = reg_need(node->rhs);
+        return l == r ? l + 1 : (l > r ? l : r);
+    }
+
+    if (node->kind == ND_FNCALL) {
+        int need = 0, i = 0;
+        for (Node *arg = node->args; arg; arg = arg->next, i++)
+            if (need < i + 1 + reg_need(arg))
+                need = i + 1 + reg_need(arg);
+        return need;
+    }
+
+    int l = reg_need(node->lhs);
+    int r = reg_need(node->rhs);
+    int need = l > r ? l : r;
+    return node->kind == ND_ASSIGN ? need + 1 : need;
+}
+
+// Evaluates the operands of a binary operator and returns the source
+// operand for the instruction. The left operand ends up in %rax, or the
+// right one if the operator is commutative and *swapped is set.
+static char *gen_operands(Node *node, bool commutative, bool imm_mem, bool *swapped, char *buf) {
+    bool wide = is_wide(node->lhs->type);
+    *swapped = false;
+
+    if (direct_operand(node->rhs, wide, imm_mem, buf)) {
+        gen_expr(node->lhs);
+        return buf;
+    }
+    if (commutative && direct_operand(node->lhs, wide, imm_mem, buf)) {
+        gen_expr(node->rhs);
+        *swapped = true;
+        return buf;
+    }
+
+    int r;
+    if (reg_need(node->lhs) > reg_need(node->rhs)) {
+        gen_expr(node->lhs);
+        push();
+        gen_expr(node->rhs);
+        if (commutative) {
+            *swapped = true;
+            r = pop_operand();
         } else {
-            println("\tlea %s(%%rip), %%rax", node->var->name);
+            println("\tmov %%rax, %%rdi");
+            pop("%rax");
+            r = -1;
         }
-        return;
+    } else {
+        gen_expr(node->rhs);
+        push();
+        gen_expr(node->lhs);
+        r = pop_operand();
+    }
+
+    if (r < 0)
+        return wide ? "%rdi" : "%edi";
+    return wide ? calleereg64[r] : calleereg32[r];
+}
+
+// ptr + (i << n) for n <= 3, i.e. indexing, is a single addressing mode.
+// Evaluates the operands and writes the memory operand to buf.
+static bool gen_index(Node *node, char *buf) {
+    if (node->kind != ND_ADD || !is_wide(node->lhs->type) ||
+        node->rhs->kind != ND_SHL || node->rhs->rhs->val > 3)
+        return false;
+
+    Node *base = node->lhs;
+    Node index = {.kind = ND_ADD, .lhs = base, .rhs = node->rhs->lhs};
+    int scale = 1 << node->rhs->rhs->val;
+    bool swapped;
+    char regbuf[64];
+
+    if (base->kind == ND_VAR && base->var->is_reg) {
+        char *reg = calleereg64[base->var->reg];
+        if (!direct_operand(index.rhs, true, false, regbuf)) {
+            gen_expr(index.rhs);
+            strcpy(regbuf, "%rax");
+        }
+        sprintf(buf, "(%s,%s,%d)", reg, regbuf, scale);
+        return true;
+    }
+
+    char *reg = gen_operands(&index, false, false, &swapped, regbuf);
+    sprintf(buf, "(%%rax,%s,%d)", reg, scale);
+    return true;
+}
+
+// Signed division and remainder by 2^n. Negative dividends are biased by
+// 2^n-1 first so that the shift rounds toward zero like idiv does.
+static bool gen_div_pow2(Node *node) {
+    if (node->rhs->kind != ND_NUM)
+        return false;
+    int64_t val = node->rhs->val;
+    if (val < 2 || (val & (val - 1)))
+        return false;
+    int n = 0;
+    while (((int64_t)1 << n) < val)
+        n++;
+    if (n >= 31)
+        return false;
+
+    bool wide = is_wide(node->lhs->type);
+    char *ax = wide ? "%rax" : "%eax";
+    char *di = wide ? "%rdi" : "%edi";
+    int bits = wide ? 64 : 32;
+
+    gen_expr(node->lhs);
+    println("\tmov %s, %s", ax, di);
+    println("\tsar $%d, %s", bits - 1, di);
+    println("\tshr $%d, %s", bits - n, di);
+    println("\tadd %s, %s", di, ax);
+    if (node->kind == ND_DIV) {
+        println("\tsar $%d, %s", n, ax);
+    } else {
+        println("\tand $%ld, %s", val - 1, ax);
+        println("\tsub %s, %s", di, ax);
+    }
+    return true;
+}
+
+// Emits a cmp for a comparison and returns the condition code under which
+// it holds.
+static char *gen_cmp(Node *node) {
+    bool wide = is_wide(node->lhs->type);
+    bool swapped = false;
+    char buf[64], buf2[64];
+
+    // A register local can be compared in place.
+    if (direct_operand(node->lhs, wide, false, buf2) &&
+        direct_operand(node->rhs, wide, true, buf)) {
+        println("\tcmp %s, %s", buf, buf2);
+    } else if (direct_operand(node->rhs, wide, false, buf2) &&
+               direct_operand(node->lhs, wide, true, buf)) {
+        println("\tcmp %s, %s", buf, buf2);
+        swapped = true;
+    } else {
+        char *di = gen_operands(node, true, true, &swapped, buf);
+        println("\tcmp %s, %s", di, wide ? "%rax" : "%eax");
+    }
+
+    switch (node->kind) {
+    case ND_EQ:
+        return "e";
+    case ND_NE:
+        return "ne";
+    case ND_LT:
+        return swapped ? "g" : "l";
+    case ND_LE:
+        return swapped ? "ge" : "le";
+    }
+    Error("not a comparison");
+}
+
+static char *negate_cc(char *cc) {
+    static char *table[][2] = {
+        {"e", "ne"}, {"ne", "e"}, {"l", "ge"},
+        {"le", "g"}, {"g", "le"}, {"ge", "l"},
+    };
+    for (int i = 0; i < sizeof(table) / sizeof(*table); i++)
+        if (!strcmp(cc, table[i][0]))
+            return table[i][1];
+    Error("unknown condition code: %s", cc);
+}
+
+// Computes the address of an lvalue and returns it as a memory operand,
+// which may refer to %rax and registers holding temporaries.
+static char *gen_mem(Node *node, char *buf) {
+    switch (node->kind) {
+    case ND_VAR:
+        assert(!node->var->is_reg);
+        return var_mem(node->var, 0, buf);
     case ND_DEREF:
+        if (gen_index(node->lhs, buf))
+            return buf;
+        if (node->lhs->kind == ND_VAR && node->lhs->var->is_reg) {
+            sprintf(buf, "(%s)", calleereg64[node->lhs->var->reg]);
+            return buf;
+        }
         gen_expr(node->lhs);
-        return;
-    case ND_DOTS:
-        gen_addr(node->lhs);
-        println("\tadd $%d, %%rax", node->member->offset);
-        return;
+        return "(%rax)";
+    case ND_DOTS: {
+        int offset = 0;
+        Node *base = node;
+        for (; base->kind == ND_DOTS; base = base->lhs)
+            offset += base->member->offset;
+        if (is_static_mem(base))
+            return var_mem(base->var, offset, buf);
+        gen_addr(base);
+        sprintf(buf, "%d(%%rax)", offset);
+        return buf;
+    }
     case ND_COMMA:
         gen_expr(node->lhs);
         gen_addr(node->rhs);
-        return;
+        return "(%rax)";
+    case ND_FNCALL:
+    case ND_STMT_EXPR:
+        // The value of a struct is its address, as left by an inlined
+        // call as well as by a real one.
+        if (is_aggregate(node->type)) {
+            gen_expr(node);
+            return "(%rax)";
+        }
+        break;
     }
     Error("not an lvalue");
 }
 
+static void gen_addr(Node *node) {
+    char buf[64];
+    char *mem = gen_mem(node, buf);
+    if (strcmp(mem, "(%rax)"))
+        println("\tlea %s, %%rax", mem);
+}
+
+// Number of temporaries currently pushed on the machine stack.
+static int num_spilled(void) {
+    int n = 0;
+    for (int d = 0; d < depth; d++)
+        if (!is_tmpreg(d))
+            n++;
+    return n;
+}
+
+// Expressions use %rdi and %rdx as scratch registers, and copying a struct
+// %rsi, %rcx and %r8, while a call clobbers them all.
+static bool clobbers_args(Node *node, bool rdx) {
+    if (!node)
+        return false;
+    if (node->kind == ND_FNCALL || (node->kind == ND_ASSIGN && is_aggregate(node->type)))
+        return true;
+    if (rdx && (node->kind == ND_DIV || node->kind == ND_MOD))
+        return true;
+    if (clobbers_args(node->lhs, rdx) || clobbers_args(node->rhs, rdx) ||
+        clobbers_args(node->cond, rdx) || clobbers_args(node->then, rdx) ||
+        clobbers_args(node->_else, rdx) || clobbers_args(node->init, rdx) ||
+        clobbers_args(node->inc, rdx))
+        return true;
+    for (Node *n = node->body; n; n = n->next)
+        if (clobbers_args(n, rdx))
+            return true;
+    for (Node *n = node->args; n; n = n->next)
+        if (clobbers_args(n, rdx))
+            return true;
+    return false;
+}
+
+// Register arguments are evaluated straight into their registers, those
+// going to %rdi last and to %rdx just before, so that the scratch use of
+// both cannot overwrite an argument already in place.
+static int arg_phase(Type *type, int r) {
+    int last = is_aggregate(type) && type->size > 8 ? r + 1 : r;
+    if (r == 0)
+        return 2;
+    return r <= 2 && last >= 2 ? 1 : 0;
+}
+
+// An argument that cannot be evaluated in place becomes a temporary first.
+static bool needs_temp(Node *arg, int r) {
+    return clobbers_args(arg, arg_phase(arg->type, r) == 2);
+}
+
+static void move_arg(Type *type, int r) {
+    if (is_aggregate(type))
+        load_aggregate(type, argreg64[r], type->size > 8 ? argreg64[r + 1] : NULL, "%rax");
+    else
+        println("\tmov %%rax, %s", argreg64[r]);
+}
+
+// Moves the temporaries pushed by gen_args() into place, the last one
+// first.
+static void pop_args(Node *arg, ArgState *st) {
+    if (!arg)
+        return;
+    int offset;
+    int r = next_arg(st, arg->type, &offset);
+    pop_args(arg->next, st);
+    if (r < 0 || !needs_temp(arg, r))
+        return;
+    if (is_aggregate(arg->type)) {
+        pop("%rax");
+        move_arg(arg->type, r);
+    } else {
+        pop(argreg64[r]);
+    }
+}
+
+// Bytes reserved by gen_args() for calls whose arguments are still being
+// evaluated.
+static int call_reserved;
+
+// Evaluates the arguments of a call and returns the size of the area
+// reserved below them. It is reserved first so that arguments passed on
+// the stack are stored straight to their place, and is padded so that
+// %rsp is 16-byte aligned at the call however many temporaries have been
+// spilled and however much enclosing calls have reserved. The caller
+// releases it from call_reserved once the arguments are in place.
+static int gen_args(Node *node, bool sret) {
+    ArgState st = {sret, 0};
+    int offset;
+    for (Node *arg = node->args; arg; arg = arg->next)
+        next_arg(&st, arg->type, &offset);
+    int stack_size = align_to(st.stack, 16);
+    stack_size += (call_reserved + num_spilled() * 8 + stack_size) % 16;
+    if (stack_size)
+        println("\tsub $%d, %%rsp", stack_size);
+    call_reserved += stack_size;
+
+    st = (ArgState){sret, 0};
+    for (Node *arg = node->args; arg; arg = arg->next) {
+        if (next_arg(&st, arg->type, &offset) >= 0)
+            continue;
+        gen_expr(arg);
+        if (is_aggregate(arg->type)) {
+            println("\tlea %d(%%rsp), %%rdi", offset);
+            copy_block(arg->type->size);
+        } else {
+            println("\tmov %%rax, %d(%%rsp)", offset);
+        }
+    }
+
+    st = (ArgState){sret, 0};
+    for (Node *arg = node->args; arg; arg = arg->next) {
+        int r = next_arg(&st, arg->type, &offset);
+        if (r >= 0 && needs_temp(arg, r)) {
+            gen_expr(arg);
+            push();
+        }
+    }
+    for (int phase = 0; phase < 3; phase++) {
+        st = (ArgState){sret, 0};
+        for (Node *arg = node->args; arg; arg = arg->next) {
+            int r = next_arg(&st, arg->type, &offset);
+            if (r < 0 || needs_temp(arg, r) || arg_phase(arg->type, r) != phase)
+                continue;
+            gen_expr(arg);
+            move_arg(arg->type, r);
+        }
+    }
+    st = (ArgState){sret, 0};
+    pop_args(node->args, &st);
+    return stack_size;
+}
+
+// A struct or union is returned in %rax and %rdx, or through memory the
+// caller passes in %rdi. Either way it ends up in the return buffer, whose
+// address becomes the value of the call. Narrow integers are sign-extended
+// as the callee may leave the upper bits undefined.
+static void gen_call(Node *node) {
+    char buf[64];
+    bool sret = in_memory(node->type);
+    int stack_size = gen_args(node, sret);
+    call_reserved -= stack_size;
+    if (sret)
+        println("\tlea %s, %%rdi", var_mem(node->ret_buffer, 0, buf));
+    println("\tmov $0, %%rax");
+    println("\tcall %s", node->fn_name);
+    if (stack_size)
+        println("\tadd $%d, %%rsp", stack_size);
+
+    if (is_aggregate(node->type)) {
+        if (!sret)
+            store_aggregate(node->type, "%rax", "%rdx", node->ret_buffer->offset, "%rbp");
+        println("\tlea %s, %%rax", var_mem(node->ret_buffer, 0, buf));
+        return;
+    }
+    if (!IsTypeInteger(node->type))
+        return;
+    if (node->type->size == 1)
+        println("\tmovsbq %%al, %%rax");
+    else if (node->type->size == 2)
+        println("\tmovswq %%ax, %%rax");
+    else if (node->type->size == 4)
+        println("\tmovsxd %%eax, %%rax");
+}
+
 static void gen_expr(Node *node) {
+    char buf[64];
+
     switch (node->kind) {
     case ND_NUM:
         println("\tmov $%ld, %%rax", node->val);
@@ -115,67 +873,81 @@ static void gen_expr(Node *node) {
         gen_expr(node->lhs);
         println("\tneg %%rax");
         return;
+    case ND_SHL:
+        assert(node->rhs->kind == ND_NUM);
+        gen_expr(node->lhs);
+        println("\tshl $%ld, %%rax", node->rhs->val);
+        return;
     case ND_VAR:
-        gen_addr(node);
-        load(node->type);
+        if (node->var->is_reg) {
+            println("\tmov %s, %%rax", calleereg64[node->var->reg]);
+            return;
+        }
+        load(node->type, gen_mem(node, buf));
         return;
     case ND_ASSIGN:
+        if (node->lhs->kind == ND_VAR && node->lhs->var->is_reg) {
+            gen_expr(node->rhs);
+            store_reg(node->lhs->var);
+            return;
+        }
+        if (is_static_mem(node->lhs)) {
+            gen_expr(node->rhs);
+            store(node->type, gen_mem(node->lhs, buf));
+            return;
+        }
         gen_addr(node->lhs);
         push();
         gen_expr(node->rhs);
-        store(node->type);
+        pop("%rdi");
+        store(node->type, "(%rdi)");
         return;
     case ND_ADDR:
         gen_addr(node->lhs);
         return;
     case ND_DEREF:
-        gen_expr(node->lhs);
-        load(node->type);
+        load(node->type, gen_mem(node, buf));
         return;
     case ND_COMMA:
         gen_expr(node->lhs);
         gen_expr(node->rhs);
         return;
     case ND_DOTS:
-        gen_addr(node);
-        load(node->type);
+        load(node->type, gen_mem(node, buf));
         return;
     case ND_STMT_EXPR:
         for (Node *n = node->body; n; n = n->next)
             gen_stmt(n);
         return;
-    case ND_FNCALL:{
-        int nargs = 0;
-        for (Node *arg = node->args; arg; arg = arg->next) {
-            gen_expr(arg);
-            push();
-            nargs++;
-        }
-        
-        for (int i = nargs - 1; i >= 0; i--)
-            pop(argreg64[i]);
-
-        println("\tmov $0, %%rax");
-        println("\tcall %s", node->fn_name);
+    case ND_DIV:
+    case ND_MOD:
+        if (gen_div_pow2(node))
+            return;
+        break;
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+        println("\tset%s %%al", gen_cmp(node));
+        println("\tmovzb %%al, %%rax");
+        return;
+    case ND_FNCALL:
+        gen_call(node);
         return;
     }
-    }
-
-    gen_expr(node->rhs);
-    push();
-    gen_expr(node->lhs);
-    pop("%rdi");
 
-    char *ax, *di;
-
-    if (node->lhs->type->kind == TY_LONG || node->lhs->type->base) {
-        ax = "%rax";
-        di = "%rdi";
-    } else {
-        ax = "%eax";
-        di = "%edi";
+    if (gen_index(node, buf)) {
+        println("\tlea %s, %%rax", buf);
+        return;
     }
 
+    bool commutative = node->kind == ND_ADD || node->kind == ND_MUL ||
+                       node->kind == ND_AND;
+    bool is_div = node->kind == ND_DIV || node->kind == ND_MOD;
+    bool swapped;
+    char *di = gen_operands(node, commutative, !is_div, &swapped, buf);
+    char *ax = is_wide(node->lhs->type) ? "%rax" : "%eax";
+
     switch (node->kind) {
     case ND_ADD:
         println("\tadd %s, %s", di, ax);
@@ -205,27 +977,163 @@ static void gen_expr(Node *node) {
         }
         return;
     case ND_AND:
-        println("and(%s, %s)", di, ax);
+        println("\tand %s, %s", di, ax);
+        return;
+    }
+
+    Error("invalid expression");
+}
+
+// Jumps to <label>.<c> if cond evaluates to jump_if. A comparison is
+// tested with its own cmp instead of being turned into 0 or 1 first.
+static void gen_cond_jump(Node *cond, bool jump_if, char *label, int c) {
+    switch (cond->kind) {
+    case ND_NUM:
+        if ((cond->val != 0) == jump_if)
+            println("\tjmp %s.%d", label, c);
         return;
     case ND_EQ:
     case ND_NE:
-    case ND_LE:
     case ND_LT:
-        println("\tcmp %s, %s", di, ax);
-        if (node->kind == ND_EQ) {
-            println("\tsete %%al");
-        } else if (node->kind == ND_NE) {
-            println("\tsetne %%al");
-        } else if (node->kind == ND_LT) {
-            println("\tsetl %%al");
-        } else if (node->kind == ND_LE) {
-            println("\tsetle %%al");
+    case ND_LE: {
+        char *cc = gen_cmp(cond);
+        println("\tj%s %s.%d", jump_if ? cc : negate_cc(cc), label, c);
+        return;
+    }
+    }
+
+    gen_expr(cond);
+    println("\tcmp $0, %%rax");
+    println("\tj%s %s.%d", jump_if ? "ne" : "e", label, c);
+}
+
+static void store_param(int r, Obj *var) {
+    int offset = var->offset;
+    int size = var->type->size;
+    if (var->is_reg) {
+        char *reg = calleereg64[var->reg];
+        if (size == 1)
+            println("\tmovsbq %s, %s", argreg8[r], reg);
+        else if (size == 2)
+            println("\tmovswq %s, %s", argreg16[r], reg);
+        else if (size == 4)
+            println("\tmovsxd %s, %s", argreg32[r], reg);
+        else
+            println("\tmov %s, %s", argreg64[r], reg);
+        return;
+    }
+
+    switch (size) {
+    case 1:
+        println("\tmov %s, %d(%%rbp)", argreg8[r], offset);
+        return;
+    case 2:
+        println("\tmov %s, %d(%%rbp)", argreg16[r], offset);
+        return;
+    case 4:
+        println("\tmov %s, %d(%%rbp)", argreg32[r], offset);
+        return;
+    case 8:
+        println("\tmov %s, %d(%%rbp)", argreg64[r], offset);
+        return;
+  }
+  Error("something is wrong");
+}
+
+// Moves the parameters from where the caller has put them into their
+// locals. Those passed on the stack are used where they are unless they
+// live in a register.
+static void store_params(Obj *fn) {
+    char buf[64];
+    ArgState st = {0, 0};
+    if (ret_ptr)
+        store_param(st.gp++, ret_ptr);
+
+    for (Obj *var = fn->params; var; var = var->next) {
+        int offset;
+        int r = next_arg(&st, var->type, &offset);
+        if (r < 0) {
+            if (var->is_reg) {
+                sprintf(buf, "%d(%%rbp)", var->offset);
+                load(var->type, buf);
+                store_reg(var);
+            }
+        } else if (is_aggregate(var->type)) {
+            store_aggregate(var->type, argreg64[r], var->type->size > 8 ? argreg64[r + 1] : NULL,
+                            var->offset, "%rbp");
+        } else {
+            store_param(r, var);
         }
-        println("\tmovzb %%al, %%rax");
+    }
+}
+
+// Moves the value of a return statement, in %rax, to where the caller
+// expects it.
+static void gen_return_value(Type *type) {
+    if (!is_aggregate(type))
+        return;
+    if (!in_memory(type)) {
+        println("\tmov %%rax, %%rsi");
+        load_aggregate(type, "%rax", "%rdx", "%rsi");
         return;
     }
+    char buf[64];
+    char *ptr = ret_ptr->is_reg ? calleereg64[ret_ptr->reg] : var_mem(ret_ptr, 0, buf);
+    println("\tmov %s, %%rdi", ptr);
+    copy_block(type->size);
+    println("\tmov %s, %%rax", ptr);
+}
 
-    Error("invalid expression");
+// True if no pointer into the frame of the current function can exist,
+// so that it may be reused by a tail call.
+static bool can_reuse_frame;
+
+static bool is_scalar(Type *type) {
+    return IsTypeInteger(type) || type->kind == TY_PTR;
+}
+
+static bool is_frame_private(Obj *fn) {
+    for (Obj *var = fn->locals; var; var = var->next)
+        if (var->is_escaped || !is_scalar(var->type))
+            return false;
+    return true;
+}
+
+// return f(args) passes the arguments and jumps instead of calling f. A
+// function calling itself jumps back to the start of its body; any other
+// callee is jumped to after the epilogue, which EmitFunc fills in for the
+// "#tailcall" marker once the callee-saved registers in use are known.
+//
+// Only calls passing scalars in registers qualify, and the callee must
+// return at least as many bits as the current function so that its result
+// needs no extension.
+static bool gen_tail_call(Node *node) {
+    if (node->kind != ND_FNCALL || !can_reuse_frame || depth)
+        return false;
+
+    Type *ret = current_fn->type->return_type;
+    if (!is_scalar(node->type) || !is_scalar(ret) || node->type->size < ret->size)
+        return false;
+    int nargs = 0;
+    for (Node *arg = node->args; arg; arg = arg->next, nargs++)
+        if (is_aggregate(arg->type) || nargs == 6)
+            return false;
+
+    call_reserved -= gen_args(node, false);
+
+    int nparams = 0;
+    for (Obj *var = current_fn->params; var; var = var->next)
+        nparams++;
+    if (node->fn_name == current_fn->name && nargs == nparams) {
+        int i = 0;
+        for (Obj *var = current_fn->params; var; var = var->next)
+            store_param(i++, var);
+        println("\tjmp .L.body.%s", current_fn->name);
+        return true;
+    }
+
+    println("#tailcall %s", node->fn_name);
+    return true;
 }
 
 static void gen_stmt(Node *node) {
@@ -234,7 +1142,10 @@ static void gen_stmt(Node *node) {
         gen_expr(node->lhs);
         return;
     case ND_RETURN:
+        if (gen_tail_call(node->lhs))
+            return;
         gen_expr(node->lhs);
+        gen_return_value(current_fn->type->return_type);
         println("\tjmp .L.return.%s", current_fn->name);
         return;
     case ND_BLOCK:
@@ -243,9 +1154,7 @@ static void gen_stmt(Node *node) {
         return;
     case ND_IF:{
         int c = count();
-        gen_expr(node->cond);
-        println("\tcmp $0, %%rax");
-        println("\tje  .L.else.%d", c);
+        gen_cond_jump(node->cond, false, ".L.else", c);
         gen_stmt(node->then);
         println("\tjmp .L.end.%d", c);
         println(".L.else.%d:", c);
@@ -255,21 +1164,27 @@ static void gen_stmt(Node *node) {
         return;
     }
     case ND_FOR:{
+        // The condition is tested at the bottom of the loop, so that each
+        // iteration takes a single conditional jump.
         int c = count();
+        Node *cond = node->cond;
+        if (cond && cond->kind == ND_NUM && cond->val)
+            cond = NULL;
+
         if (node->init)
             gen_stmt(node->init);
+        if (cond)
+            println("\tjmp .L.cond.%d", c);
         println(".L.begin.%d:", c);
-        if (node->cond) {
-            gen_expr(node->cond);
-            println("\tcmp $0, %%rax");
-            println("\tje  .L.end.%d", c);
-        }
-        
         gen_stmt(node->then);
         if (node->inc)
             gen_expr(node->inc);
-        println("\tjmp .L.begin.%d", c);
-        println(".L.end.%d:", c);
+        if (cond) {
+            println(".L.cond.%d:", c);
+            gen_cond_jump(cond, true, ".L.begin", c);
+        } else {
+            println("\tjmp .L.begin.%d", c);
+        }
         return;
     }
     }
@@ -277,9 +1192,56 @@ static void gen_stmt(Node *node) {
     Error("invalid expression");
 }
 
+static bool is_reg_candidate(Obj *var) {
+    return !var->is_reg && !var->is_escaped &&
+           (IsTypeInteger(var->type) || var->type->kind == TY_PTR);
+}
+
+// Gives the most frequently used locals (loops weigh more) a callee-saved
+// register for the whole function.
+static void InitLVarReg(Obj *func) {
+    for (Obj *lv = func->locals; lv; lv = lv->next)
+        lv->is_reg = false;
+    MarkEscapedLVars(func);
+
+    int nregs = 0;
+    if (!OptStackMachine) {
+        while (nregs < MAX_REG_LVARS) {
+            Obj *best = NULL;
+            for (Obj *lv = func->locals; lv; lv = lv->next)
+                if (is_reg_candidate(lv) && (!best || best->use_count < lv->use_count))
+                    best = lv;
+            if (!best)
+                break;
+            best->is_reg = true;
+            best->reg = NUM_CALLEEREG - 1 - nregs++;
+            used_calleereg[best->reg] = true;
+        }
+    }
+    num_tmpreg = NUM_CALLEEREG - nregs;
+}
+
+// Parameters passed on the stack stay in the argument area of the caller,
+// above the saved %rbp and the return address.
+static bool InitParamOffset(Obj *func) {
+    ArgState st = {in_memory(func->type->return_type), 0};
+    bool on_stack = false;
+    for (Obj *var = func->params; var; var = var->next) {
+        int offset;
+        var->offset = 0;
+        if (next_arg(&st, var->type, &offset) < 0) {
+            var->offset = 16 + offset;
+            on_stack = true;
+        }
+    }
+    return on_stack;
+}
+
 static void InitLVarOffset(Obj *func) {
     int offset = 0;
     for (Obj *lv = func->locals; lv; lv = lv->next) {
+        if (lv->is_reg || lv->offset > 0)
+            continue;
         offset += lv->type->size;
         offset = align_to(offset, lv->type->align);
         lv->offset = -offset;
@@ -287,25 +1249,225 @@ static void InitLVarOffset(Obj *func) {
     func->stack_size = align_to(offset, 16);
 }
 
-static void store_param(int r, int offset, int size) {
-    switch (size) {
-    case 1:
-        println("\tmov %s, %d(%%rbp)", argreg8[r], offset);
+//===================================================================
+// IR backend
+//===================================================================
+// A straightforward backend for the IR: every value has its own stack slot
+// below the locals and phis are resolved by copies on the incoming edges.
+static int ir_slot_base;
+static int ir_label;
+
+static char *ir_slot(IrInsn *val, char *buf) {
+    sprintf(buf, "%d(%%rbp)", -(ir_slot_base + val->id * 8));
+    return buf;
+}
+
+static void ir_load(IrInsn *val, char *reg) {
+    char buf[32];
+    println("\tmov %s, %s", ir_slot(val, buf), reg);
+}
+
+static void ir_store(IrInsn *val) {
+    char buf[32];
+    println("\tmov %%rax, %s", ir_slot(val, buf));
+}
+
+// Phis are evaluated in parallel, so all operands are read before any phi
+// is written.
+static void gen_phi_copies(IrInsn *insn, int pred) {
+    if (!insn)
         return;
-    case 2:
-        println("\tmov %s, %d(%%rbp)", argreg16[r], offset);
+    if (insn->op != IR_PHI) {
+        gen_phi_copies(insn->next, pred);
         return;
-    case 4:
-        println("\tmov %s, %d(%%rbp)", argreg32[r], offset);
+    }
+    ir_load(insn->args[pred], "%rax");
+    println("\tpush %%rax");
+    gen_phi_copies(insn->next, pred);
+    println("\tpop %%rax");
+    ir_store(insn);
+}
+
+static void gen_edge(IrBlock *from, IrBlock *to) {
+    int pred = 0;
+    while (to->preds[pred] != from)
+        pred++;
+    gen_phi_copies(to->insns, pred);
+    println("\tjmp .L.bb.%d.%d", ir_label, to->id);
+}
+
+static void gen_ir_insn(IrInsn *insn) {
+    char buf[32];
+    IrInsn **args = insn->args;
+
+    switch (insn->op) {
+    case IR_IMM:
+        println("\tmov $%ld, %%rax", insn->val);
+        break;
+    case IR_PARAM:
+        println("\tmov %s, %%rax", argreg64[insn->val]);
+        break;
+    case IR_ADDR:
+        println("\tlea %s, %%rax", var_mem(insn->var, 0, buf));
+        break;
+    case IR_LOAD:
+        ir_load(args[0], "%rax");
+        load(insn->type, "(%rax)");
+        break;
+    case IR_STORE:
+        ir_load(args[0], "%rdi");
+        ir_load(args[1], "%rax");
+        store(insn->type, "(%rdi)");
         return;
-    case 8:
-        println("\tmov %s, %d(%%rbp)", argreg64[r], offset);
+    case IR_EXT:
+        ir_load(args[0], "%rax");
+        if (insn->type->size == 1)
+            println("\tmovsbq %%al, %%rax");
+        else if (insn->type->size == 2)
+            println("\tmovswq %%ax, %%rax");
+        else if (insn->type->size == 4)
+            println("\tmovsxd %%eax, %%rax");
+        break;
+    case IR_NEG:
+        ir_load(args[0], "%rax");
+        println("\tneg %%rax");
+        break;
+    case IR_CALL:
+        for (int i = 0; i < insn->nargs; i++)
+            ir_load(args[i], argreg64[i]);
+
+        // A call to the function itself reads its arguments again with
+        // IR_PARAM at the start of the entry block. The extension of a
+        // narrow result can be skipped if the function returns no more
+        // bits than the callee.
+        IrInsn *val = insn;
+        IrInsn *ret = insn->next;
+        if (ret && ret->op == IR_EXT && ret->args[0] == insn &&
+            ret->type->size >= current_fn->type->return_type->size) {
+            val = ret;
+            ret = ret->next;
+        }
+        if (can_reuse_frame && ret && ret->op == IR_RET && ret->nargs && ret->args[0] == val) {
+            if (insn->fn_name == current_fn->name) {
+                println("\tjmp .L.bb.%d.0", ir_label);
+                return;
+            }
+            println("\tmov %%rbp, %%rsp");
+            println("\tpop %%rbp");
+            println("\tmov $0, %%rax");
+            println("\tjmp %s", insn->fn_name);
+            return;
+        }
+        println("\tmov $0, %%rax");
+        println("\tcall %s", insn->fn_name);
+        break;
+    case IR_PHI:
         return;
-  }
-  Error("something is wrong");
+    case IR_JMP:
+        gen_edge(insn->block, insn->then);
+        return;
+    case IR_BR: {
+        int c = count();
+        ir_load(args[0], "%rax");
+        println("\tcmp $0, %%rax");
+        println("\tje .L.else.%d", c);
+        gen_edge(insn->block, insn->then);
+        println(".L.else.%d:", c);
+        gen_edge(insn->block, insn->els);
+        return;
+    }
+    case IR_RET:
+        if (insn->nargs)
+            ir_load(args[0], "%rax");
+        println("\tjmp .L.return.%s", current_fn->name);
+        return;
+    default: {
+        char *ax = insn->wide ? "%rax" : "%eax";
+        char *di = insn->wide ? "%rdi" : "%edi";
+        ir_load(args[0], "%rax");
+        ir_load(args[1], "%rdi");
+
+        switch (insn->op) {
+        case IR_ADD:
+            println("\tadd %s, %s", di, ax);
+            break;
+        case IR_SUB:
+            println("\tsub %s, %s", di, ax);
+            break;
+        case IR_MUL:
+            println("\timul %s, %s", di, ax);
+            break;
+        case IR_DIV:
+        case IR_MOD:
+            println(insn->wide ? "\tcqo" : "\tcdq");
+            println("\tidiv %s", di);
+            if (insn->op == IR_MOD)
+                println("\tmov %s, %s", insn->wide ? "%rdx" : "%edx", ax);
+            break;
+        case IR_AND:
+            println("\tand %s, %s", di, ax);
+            break;
+        case IR_SHL:
+            println("\tmov %%rdi, %%rcx");
+            println("\tshl %%cl, %%rax");
+            break;
+        case IR_EQ:
+        case IR_NE:
+        case IR_LT:
+        case IR_LE: {
+            static char *cc[] = {"e", "ne", "l", "le"};
+            println("\tcmp %s, %s", di, ax);
+            println("\tset%s %%al", cc[insn->op - IR_EQ]);
+            println("\tmovzb %%al, %%rax");
+            break;
+        }
+        default:
+            Error("invalid IR instruction");
+        }
+    }
+    }
+    ir_store(insn);
+}
+
+static void EmitFuncIR(Obj *fn) {
+    IrFunc *ir = GenIR(fn);
+    for (Obj *lv = fn->locals; lv; lv = lv->next)
+        lv->is_reg = false;
+    InitLVarOffset(fn);
+    ir_slot_base = fn->stack_size;
+    fn->stack_size = align_to(ir_slot_base + ir->nvalues * 8, 16);
+    ir_label = count();
+    current_fn = fn;
+    can_reuse_frame = is_frame_private(fn);
+
+    Insn head = {};
+    insn_tail = &head.next;
+    println(".text");
+    println("\t.globl %s", fn->name);
+    println("%s:", fn->name);
+    println("\tpush %%rbp");
+    println("\tmov %%rsp, %%rbp");
+    println("\tsub $%d, %%rsp", fn->stack_size);
+
+    for (IrBlock *block = ir->blocks; block; block = block->next) {
+        println(".L.bb.%d.%d:", ir_label, block->id);
+        for (IrInsn *insn = block->insns; insn; insn = insn->next)
+            gen_ir_insn(insn);
+    }
+
+    println(".L.return.%s:", fn->name);
+    println("\tmov %%rbp, %%rsp");
+    println("\tpop %%rbp");
+    println("\tret");
+    insn_tail = NULL;
+
+    Peephole(&head.next);
+    emit_insns(head.next);
 }
 
 static void EmitData(Obj* gvar) {
+    Insn head = {};
+    insn_tail = &head.next;
     for (Obj *var = gvar; var; var = var->next) {
         if (var->is_func) continue;
 
@@ -320,36 +1482,141 @@ static void EmitData(Obj* gvar) {
             println("\t.zero %d", var->type->size);
         }
     }
+    insn_tail = NULL;
+    emit_insns(head.next);
 }
 
-static void EmitFunc(Obj *func) {
-    for (Obj *fn = func; fn; fn = fn->next) {
-        if (!fn->is_func || !fn->is_def) continue;
-        assert(fn->is_func);
-        InitLVarOffset(fn);
-        current_fn = fn;
-        println(".text");
-        println("\t.globl %s", fn->name);
-        
-        println("%s:", fn->name);
+// A leaf function that never pushes can keep its frame in the red zone,
+// the 128 bytes below %rsp that the ABI guarantees are not clobbered
+// asynchronously, and so needs no %rbp.
+static bool is_frameless(Insn *body, int frame_size) {
+    if (frame_size > 128)
+        return false;
+    for (Insn *insn = body; insn; insn = insn->next) {
+        if (insn->kind == IN_DIRECTIVE && !strncmp(insn->op, "#tailcall ", 10))
+            return false;
+        if (insn->kind == IN_INSN && (!strcmp(insn->op, "call") ||
+            !strcmp(insn->op, "push") || !strcmp(insn->op, "pop")))
+            return false;
+    }
+    return true;
+}
+
+// Rewrites every off(%rbp) into off(%rsp). Without a frame %rsp stays
+// where %rbp would have pointed.
+static void use_rsp(Insn *insn) {
+    for (; insn; insn = insn->next) {
+        for (int i = 0; i < insn->nops; i++) {
+            char *p = strstr(insn->ops[i], "(%rbp)");
+            if (p)
+                p[3] = 's';
+        }
+    }
+}
+
+static void EmitFuncAST(Obj *fn) {
+    ret_ptr = NULL;
+    if (in_memory(fn->type->return_type)) {
+        ret_ptr = FnAlloc(sizeof(Obj));
+        ret_ptr->name = "";
+        ret_ptr->type = NewTypePTR2(fn->type->return_type);
+        ret_ptr->is_lvar = true;
+        ret_ptr->next = fn->locals;
+        fn->locals = ret_ptr;
+    }
+
+    for (int i = 0; i < NUM_CALLEEREG; i++)
+        used_calleereg[i] = false;
+    InitLVarReg(fn);
+    bool stack_params = InitParamOffset(fn);
+    InitLVarOffset(fn);
+    current_fn = fn;
 
+    can_reuse_frame = is_frame_private(fn);
+
+    // The body is generated first so that we know which callee-saved
+    // registers it uses before emitting the prologue.
+    Insn body = {};
+    insn_tail = &body.next;
+    for (Node *n = fn->body; n; n = n->next) {
+        gen_stmt(n);
+        assert(depth == 0);
+    }
+
+    int save_offset[NUM_CALLEEREG];
+    int offset = fn->stack_size;
+    for (int i = 0; i < NUM_CALLEEREG; i++) {
+        if (used_calleereg[i]) {
+            offset += 8;
+            save_offset[i] = -offset;
+        }
+    }
+    fn->stack_size = align_to(offset, 16);
+    bool frameless = !stack_params && is_frameless(body.next, offset);
+
+    Insn head = {};
+    insn_tail = &head.next;
+    println(".text");
+    println("\t.globl %s", fn->name);
+    println("%s:", fn->name);
+    if (!frameless) {
         println("\tpush %%rbp");
         println("\tmov %%rsp, %%rbp");
         println("\tsub $%d, %%rsp", fn->stack_size);
+    }
+    for (int i = 0; i < NUM_CALLEEREG; i++)
+        if (used_calleereg[i])
+            println("\tmov %s, %d(%%rbp)", calleereg64[i], save_offset[i]);
 
-        int i = 0;
-        for (Obj *var = fn->params; var; var = var->next) {
-            store_param(i++, var->offset, var->type->size);
-        }
+    store_params(fn);
+    println(".L.body.%s:", fn->name);
 
-        for (Node *n = fn->body; n; n = n->next) {
-            gen_stmt(n);
-            assert(depth == 0);
+    for (Insn *insn = body.next; insn; insn = insn->next) {
+        *insn_tail = insn;
+        if (insn->kind != IN_DIRECTIVE || strncmp(insn->op, "#tailcall ", 10)) {
+            insn_tail = &insn->next;
+            continue;
         }
-        println(".L.return.%s:", fn->name);
+        for (int i = 0; i < NUM_CALLEEREG; i++)
+            if (used_calleereg[i])
+                println("\tmov %d(%%rbp), %s", save_offset[i], calleereg64[i]);
         println("\tmov %%rbp, %%rsp");
         println("\tpop %%rbp");
-        println("\tret");
+        println("\tmov $0, %%rax");
+        println("\tjmp %s", insn->op + 10);
+    }
+
+    println(".L.return.%s:", fn->name);
+    for (int i = 0; i < NUM_CALLEEREG; i++)
+        if (used_calleereg[i])
+            println("\tmov %d(%%rbp), %s", save_offset[i], calleereg64[i]);
+    if (!frameless) {
+        println("\tmov %%rbp, %%rsp");
+        println("\tpop %%rbp");
+    }
+    println("\tret");
+    insn_tail = NULL;
+
+    if (frameless)
+        use_rsp(head.next);
+    Peephole(&head.next);
+    emit_insns(head.next);
+}
+
+static void EmitFunc(Obj *func) {
+    for (Obj *fn = func; fn; fn = fn->next) {
+        if (!fn->is_func || !fn->is_def) continue;
+        FnArena = fn->arena;
+        if (OptIR && !NeedsFullABI(fn))
+            EmitFuncIR(fn);
+        else
+            EmitFuncAST(fn);
+
+        // Nothing refers to the body once it has been written out.
+        fn->body = NULL;
+        fn->locals = fn->params = NULL;
+        FreeArena(fn->arena);
+        FnArena = NULL;
     }
 }
 
@@ -358,4 +1625,8 @@ void GenCode(Obj *prog, FILE *out) {
 
     EmitData(prog);
     EmitFunc(prog);
+    if (OptEmitObj)
+        WriteObj(out);
+    else
+        flush_out();
 }
\ No newline at end of file
@@ -0,0 +1,531 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "5cc.h"
+
+// Lowers the AST of a function to the IR described in 5cc.h.
+//
+// SSA form is built while lowering, following Braun et al., "Simple and
+// Efficient Construction of Static Single Assignment Form": every block
+// records the current value of each variable assigned in it, a read looks
+// the value up through the predecessors and inserts a phi where they may
+// disagree. A block is sealed once all its predecessors are known; reads in
+// an unsealed block (a loop header) create phis that are completed later.
+
+struct IrDef {
+    IrDef *next;
+    Obj *var;
+    IrInsn *val;
+};
+
+static IrFunc *cur_fn;
+static IrBlock **block_tail;
+static IrBlock *cur_block;
+static IrInsn *last_value;  // value of the last expression statement
+
+//===================================================================
+// Blocks and instructions
+//===================================================================
+static IrBlock *new_block(void) {
+    IrBlock *block = FnAlloc(sizeof(IrBlock));
+    *block_tail = block;
+    block_tail = &block->next;
+    return block;
+}
+
+// Returns arr, which holds n elements, with room for one more. The
+// capacity is the smallest power of two not below n, so the array moves to
+// a block twice as large in the function's arena only once it is full.
+static void *grow_array(void *arr, int n, size_t size) {
+    if (n & (n - 1))
+        return arr;
+    void *new = FnAlloc(size * (n ? n * 2 : 1));
+    if (n)
+        memcpy(new, arr, size * n);
+    return new;
+}
+
+static void add_pred(IrBlock *block, IrBlock *pred) {
+    assert(!block->sealed);
+    block->preds = grow_array(block->preds, block->npreds, sizeof(IrBlock *));
+    block->preds[block->npreds++] = pred;
+}
+
+static IrInsn *new_insn(IrOp op) {
+    IrInsn *insn = FnAlloc(sizeof(IrInsn));
+    insn->op = op;
+    return insn;
+}
+
+static void add_arg(IrInsn *insn, IrInsn *arg) {
+    insn->args = grow_array(insn->args, insn->nargs, sizeof(IrInsn *));
+    insn->args[insn->nargs++] = arg;
+}
+
+static IrInsn *emit(IrOp op) {
+    IrInsn *insn = new_insn(op);
+    insn->block = cur_block;
+    if (cur_block->last)
+        cur_block->last->next = insn;
+    else
+        cur_block->insns = insn;
+    cur_block->last = insn;
+    return insn;
+}
+
+// Phis and undefined values go before everything else in a block.
+static IrInsn *emit_head(IrBlock *block, IrOp op) {
+    IrInsn *insn = new_insn(op);
+    insn->block = block;
+    insn->next = block->insns;
+    block->insns = insn;
+    if (!block->last)
+        block->last = insn;
+    return insn;
+}
+
+static IrInsn *emit_unary(IrOp op, IrInsn *lhs) {
+    IrInsn *insn = emit(op);
+    add_arg(insn, lhs);
+    return insn;
+}
+
+static IrInsn *emit_binary(IrOp op, IrInsn *lhs, IrInsn *rhs, bool wide) {
+    IrInsn *insn = emit(op);
+    insn->wide = wide;
+    add_arg(insn, lhs);
+    add_arg(insn, rhs);
+    return insn;
+}
+
+static IrInsn *emit_imm(int64_t val) {
+    IrInsn *insn = emit(IR_IMM);
+    insn->val = val;
+    return insn;
+}
+
+static void emit_jmp(IrBlock *to) {
+    IrInsn *insn = emit(IR_JMP);
+    insn->then = to;
+    add_pred(to, cur_block);
+}
+
+static void emit_br(IrInsn *cond, IrBlock *then, IrBlock *els) {
+    IrInsn *insn = emit(IR_BR);
+    add_arg(insn, cond);
+    insn->then = then;
+    insn->els = els;
+    add_pred(then, cur_block);
+    add_pred(els, cur_block);
+}
+
+static void start_block(IrBlock *block) {
+    cur_block = block;
+}
+
+//===================================================================
+// SSA construction
+//===================================================================
+static bool is_scalar(Type *ty) {
+    return IsTypeInteger(ty) || ty->kind == TY_PTR;
+}
+
+static bool is_ssa_var(Obj *var) {
+    return var->is_lvar && !var->is_escaped && is_scalar(var->type);
+}
+
+static IrInsn *resolve(IrInsn *val) {
+    while (val->replace)
+        val = val->replace;
+    return val;
+}
+
+static IrDef *find_def(IrDef *defs, Obj *var) {
+    for (IrDef *d = defs; d; d = d->next)
+        if (d->var == var)
+            return d;
+    return NULL;
+}
+
+static void write_var(Obj *var, IrBlock *block, IrInsn *val) {
+    IrDef *def = find_def(block->defs, var);
+    if (!def) {
+        def = FnAlloc(sizeof(IrDef));
+        def->var = var;
+        def->next = block->defs;
+        block->defs = def;
+    }
+    def->val = val;
+}
+
+static IrInsn *read_var(Obj *var, IrBlock *block);
+
+// A phi whose operands are all the same value, or the phi itself, is
+// replaced by that value.
+static IrInsn *remove_trivial_phi(IrInsn *phi) {
+    IrInsn *same = NULL;
+    for (int i = 0; i < phi->nargs; i++) {
+        IrInsn *arg = resolve(phi->args[i]);
+        if (arg == same || arg == phi)
+            continue;
+        if (same)
+            return phi;
+        same = arg;
+    }
+    if (!same)
+        return phi;
+    phi->replace = same;
+    return same;
+}
+
+static IrInsn *add_phi_operands(Obj *var, IrInsn *phi) {
+    IrBlock *block = phi->block;
+    for (int i = 0; i < block->npreds; i++)
+        add_arg(phi, read_var(var, block->preds[i]));
+    return remove_trivial_phi(phi);
+}
+
+static IrInsn *read_var_rec(Obj *var, IrBlock *block) {
+    IrInsn *val;
+    if (!block->sealed) {
+        val = emit_head(block, IR_PHI);
+        val->var = var;
+        IrDef *def = FnAlloc(sizeof(IrDef));
+        def->var = var;
+        def->val = val;
+        def->next = block->incomplete;
+        block->incomplete = def;
+    } else if (block->npreds == 0) {
+        // Read before any assignment
+        val = emit_head(block, IR_IMM);
+    } else if (block->npreds == 1) {
+        val = read_var(var, block->preds[0]);
+    } else {
+        IrInsn *phi = emit_head(block, IR_PHI);
+        phi->var = var;
+        write_var(var, block, phi);
+        val = add_phi_operands(var, phi);
+    }
+    write_var(var, block, val);
+    return val;
+}
+
+static IrInsn *read_var(Obj *var, IrBlock *block) {
+    IrDef *def = find_def(block->defs, var);
+    if (def)
+        return resolve(def->val);
+    return resolve(read_var_rec(var, block));
+}
+
+static void seal_block(IrBlock *block) {
+    block->sealed = true;
+    for (IrDef *d = block->incomplete; d; d = d->next)
+        add_phi_operands(d->var, d->val);
+    block->incomplete = NULL;
+}
+
+//===================================================================
+// Lowering
+//===================================================================
+static bool is_wide(Type *ty) {
+    return ty->kind == TY_LONG || ty->base;
+}
+
+static bool is_aggregate(Type *ty) {
+    return ty->kind == TY_ARRAY || ty->kind == TY_STRUCT || ty->kind == TY_UNION;
+}
+
+static IrInsn *gen_expr(Node *node);
+static void gen_stmt(Node *node);
+
+static IrInsn *gen_load(Type *ty, IrInsn *addr) {
+    if (is_aggregate(ty))
+        return addr;
+    IrInsn *insn = emit_unary(IR_LOAD, addr);
+    insn->type = ty;
+    return insn;
+}
+
+static IrInsn *gen_addr(Node *node) {
+    switch (node->kind) {
+    case ND_VAR: {
+        assert(!is_ssa_var(node->var));
+        IrInsn *insn = emit(IR_ADDR);
+        insn->var = node->var;
+        return insn;
+    }
+    case ND_DEREF:
+        return gen_expr(node->lhs);
+    case ND_DOTS: {
+        IrInsn *base = gen_addr(node->lhs);
+        if (!node->member->offset)
+            return base;
+        return emit_binary(IR_ADD, base, emit_imm(node->member->offset), true);
+    }
+    case ND_COMMA:
+        gen_expr(node->lhs);
+        return gen_addr(node->rhs);
+    case ND_STMT_EXPR:
+        if (is_aggregate(node->type))
+            return gen_expr(node);
+        break;
+    }
+    ErrorToken(node->tok, "not an lvalue");
+    return NULL;
+}
+
+static IrOp binary_op(NodeKind kind) {
+    switch (kind) {
+    case ND_ADD: return IR_ADD;
+    case ND_SUB: return IR_SUB;
+    case ND_MUL: return IR_MUL;
+    case ND_DIV: return IR_DIV;
+    case ND_MOD: return IR_MOD;
+    case ND_AND: return IR_AND;
+    case ND_SHL: return IR_SHL;
+    case ND_EQ: return IR_EQ;
+    case ND_NE: return IR_NE;
+    case ND_LT: return IR_LT;
+    case ND_LE: return IR_LE;
+    }
+    Error("invalid expression");
+    return 0;
+}
+
+static IrInsn *gen_expr(Node *node) {
+    switch (node->kind) {
+    case ND_NUM:
+        return emit_imm(node->val);
+    case ND_NEG:
+        return emit_unary(IR_NEG, gen_expr(node->lhs));
+    case ND_VAR:
+        if (is_ssa_var(node->var))
+            return read_var(node->var, cur_block);
+        return gen_load(node->type, gen_addr(node));
+    case ND_ASSIGN: {
+        if (node->lhs->kind == ND_VAR && is_ssa_var(node->lhs->var)) {
+            Obj *var = node->lhs->var;
+            IrInsn *val = gen_expr(node->rhs);
+            IrInsn *ext = emit_unary(IR_EXT, val);
+            ext->type = var->type;
+            write_var(var, cur_block, ext);
+            return val;
+        }
+        IrInsn *addr = gen_addr(node->lhs);
+        IrInsn *val = gen_expr(node->rhs);
+        IrInsn *insn = emit_binary(IR_STORE, addr, val, false);
+        insn->type = node->type;
+        return val;
+    }
+    case ND_ADDR:
+        return gen_addr(node->lhs);
+    case ND_DEREF:
+        return gen_load(node->type, gen_expr(node->lhs));
+    case ND_DOTS:
+        return gen_load(node->type, gen_addr(node));
+    case ND_COMMA:
+        gen_expr(node->lhs);
+        return gen_expr(node->rhs);
+    case ND_STMT_EXPR:
+        last_value = NULL;
+        for (Node *n = node->body; n; n = n->next)
+            gen_stmt(n);
+        return last_value ? last_value : emit_imm(0);
+    case ND_FNCALL: {
+        int nargs = 0;
+        for (Node *arg = node->args; arg; arg = arg->next)
+            nargs++;
+        IrInsn **args = FnAlloc((nargs + 1) * sizeof(IrInsn *));
+        nargs = 0;
+        for (Node *arg = node->args; arg; arg = arg->next)
+            args[nargs++] = gen_expr(arg);
+        IrInsn *insn = emit(IR_CALL);
+        insn->fn_name = node->fn_name;
+        for (int i = 0; i < nargs; i++)
+            add_arg(insn, args[i]);
+        if (!IsTypeInteger(node->type) || node->type->size == 8)
+            return insn;
+
+        // The callee may leave the upper bits of a narrow integer undefined.
+        IrInsn *ext = emit_unary(IR_EXT, insn);
+        ext->type = node->type;
+        return ext;
+    }
+    }
+
+    IrInsn *lhs = gen_expr(node->lhs);
+    IrInsn *rhs = gen_expr(node->rhs);
+    return emit_binary(binary_op(node->kind), lhs, rhs, is_wide(node->lhs->type));
+}
+
+static void gen_stmt(Node *node) {
+    switch (node->kind) {
+    case ND_EXPR_STMT:
+        last_value = gen_expr(node->lhs);
+        return;
+    case ND_RETURN: {
+        // Anything after a return goes to a block without predecessors.
+        emit_unary(IR_RET, gen_expr(node->lhs));
+        IrBlock *next = new_block();
+        seal_block(next);
+        start_block(next);
+        return;
+    }
+    case ND_BLOCK:
+        for (Node *n = node->body; n; n = n->next)
+            gen_stmt(n);
+        return;
+    case ND_IF: {
+        IrBlock *then = new_block();
+        IrBlock *els = new_block();
+        IrBlock *end = new_block();
+        emit_br(gen_expr(node->cond), then, els);
+        seal_block(then);
+        seal_block(els);
+
+        start_block(then);
+        gen_stmt(node->then);
+        emit_jmp(end);
+
+        start_block(els);
+        if (node->_else)
+            gen_stmt(node->_else);
+        emit_jmp(end);
+
+        seal_block(end);
+        start_block(end);
+        return;
+    }
+    case ND_FOR: {
+        if (node->init)
+            gen_stmt(node->init);
+
+        // The header is sealed after the back edge has been added.
+        IrBlock *cond = new_block();
+        IrBlock *body = new_block();
+        IrBlock *end = new_block();
+        emit_jmp(cond);
+
+        start_block(cond);
+        if (node->cond)
+            emit_br(gen_expr(node->cond), body, end);
+        else
+            emit_jmp(body);
+        seal_block(body);
+        seal_block(end);
+
+        start_block(body);
+        gen_stmt(node->then);
+        if (node->inc)
+            gen_expr(node->inc);
+        emit_jmp(cond);
+        seal_block(cond);
+
+        start_block(end);
+        return;
+    }
+    }
+
+    Error("invalid statement");
+}
+
+//===================================================================
+// Cleanup
+//===================================================================
+// Drops removed phis, points operands at the values that replaced them
+// and numbers blocks and values.
+static void finish(IrFunc *ir) {
+    int nblocks = 0;
+    int nvalues = 0;
+    for (IrBlock *block = ir->blocks; block; block = block->next) {
+        block->id = nblocks++;
+        for (IrInsn **p = &block->insns; *p;) {
+            IrInsn *insn = *p;
+            if (insn->replace) {
+                *p = insn->next;
+                continue;
+            }
+            for (int i = 0; i < insn->nargs; i++)
+                insn->args[i] = resolve(insn->args[i]);
+            if (insn->op != IR_STORE && insn->op != IR_JMP &&
+                insn->op != IR_BR && insn->op != IR_RET)
+                insn->id = ++nvalues;
+            p = &insn->next;
+        }
+    }
+    ir->nvalues = nvalues;
+}
+
+static bool has_complex_call(Node *node) {
+    if (!node)
+        return false;
+    if (node->kind == ND_FNCALL) {
+        if (is_aggregate(node->type))
+            return true;
+        int nargs = 0;
+        for (Node *arg = node->args; arg; arg = arg->next)
+            if (is_aggregate(arg->type) || ++nargs > 6)
+                return true;
+    }
+    if (has_complex_call(node->lhs) || has_complex_call(node->rhs) ||
+        has_complex_call(node->cond) || has_complex_call(node->then) ||
+        has_complex_call(node->_else) || has_complex_call(node->init) ||
+        has_complex_call(node->inc))
+        return true;
+    for (Node *n = node->body; n; n = n->next)
+        if (has_complex_call(n))
+            return true;
+    for (Node *n = node->args; n; n = n->next)
+        if (has_complex_call(n))
+            return true;
+    return false;
+}
+
+// The IR only passes scalars in registers. Functions needing more of the
+// calling convention are left to the AST backend.
+bool NeedsFullABI(Obj *fn) {
+    if (is_aggregate(fn->type->return_type))
+        return true;
+    int nparams = 0;
+    for (Obj *var = fn->params; var; var = var->next)
+        if (is_aggregate(var->type) || ++nparams > 6)
+            return true;
+    return has_complex_call(fn->body);
+}
+
+IrFunc *GenIR(Obj *fn) {
+    IrFunc *ir = FnAlloc(sizeof(IrFunc));
+    ir->fn = fn;
+    cur_fn = ir;
+    block_tail = &ir->blocks;
+    MarkEscapedLVars(fn);
+
+    IrBlock *entry = new_block();
+    seal_block(entry);
+    start_block(entry);
+
+    int i = 0;
+    for (Obj *var = fn->params; var; var = var->next) {
+        IrInsn *param = emit(IR_PARAM);
+        param->val = i++;
+        if (is_ssa_var(var)) {
+            IrInsn *ext = emit_unary(IR_EXT, param);
+            ext->type = var->type;
+            write_var(var, cur_block, ext);
+            continue;
+        }
+        IrInsn *addr = emit(IR_ADDR);
+        addr->var = var;
+        IrInsn *store = emit_binary(IR_STORE, addr, param, false);
+        store->type = var->type;
+    }
+
+    for (Node *n = fn->body; n; n = n->next)
+        gen_stmt(n);
+    emit(IR_RET);
+
+    finish(ir);
+    return ir;
+}
@@ -10,12 +10,17 @@
 static char *opt_o;
 static char *opt_c;
 static bool opt_D;
+static bool opt_dump_ir;
 
 char *InputPath;
 char *UserInput;
+bool OptStackMachine;
+bool OptIR;
+bool OptNoInline;
+bool OptEmitObj;
 
 static void usage(int status) {
-    fprintf(stderr, "5cc [ -o <path> || -c <cmd>] <file>\n");
+    fprintf(stderr, "5cc [ -o <path> || -c <cmd>] [-fstack-machine] [-fno-inline] [-fir] [-dump-ir] [-emit-obj] <file>\n");
     exit(status);
 }
 
@@ -56,7 +61,12 @@ void Compile(char *code, FILE *out) {
     Token *token = Tokenize(code);
     if (opt_D) PrintToken(token);
     Obj *node = ParseToken(token);
+    Optimize(node);
     if (opt_D) PrintObjFn(node);
+    if (opt_dump_ir)
+        for (Obj *fn = node; fn; fn = fn->next)
+            if (fn->is_func && fn->is_def && !NeedsFullABI(fn))
+                PrintIR(GenIR(fn));
     GenCode(node, out);
 }
 
@@ -83,6 +93,26 @@ static void ParseArgs(int argc, char **argv) {
             opt_D = true;
             continue;
         }
+        if (!strcmp(argv[i], "-fstack-machine")) {
+            OptStackMachine = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-fno-inline")) {
+            OptNoInline = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-fir")) {
+            OptIR = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-dump-ir")) {
+            opt_dump_ir = true;
+            continue;
+        }
+        if (!strcmp(argv[i], "-emit-obj")) {
+            OptEmitObj = true;
+            continue;
+        }
         if (argv[i][0] == '-' && argv[i][1] != '\0')
             Error("unknown argument: %s", argv[i]);
 
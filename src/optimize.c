@@ -0,0 +1,1057 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "5cc.h"
+
+//===================================================================
+// Helpers
+//===================================================================
+static bool is_num(Node *node) {
+    return node->kind == ND_NUM;
+}
+
+static bool is_num_val(Node *node, int64_t val) {
+    return node->kind == ND_NUM && node->val == val;
+}
+
+// Arithmetic is done in 64 bits if the left operand is a long or a
+// pointer and in 32 bits otherwise, just as gen_expr() does.
+static bool is_wide(Type *ty) {
+    return ty->kind == TY_LONG || ty->base;
+}
+
+static bool is_binary_cmp(Node *node) {
+    return node->kind == ND_EQ || node->kind == ND_NE ||
+           node->kind == ND_LT || node->kind == ND_LE;
+}
+
+static int log2_of(int64_t val) {
+    if (val <= 0 || (val & (val - 1)))
+        return -1;
+    int n = 0;
+    while (val > 1) {
+        val >>= 1;
+        n++;
+    }
+    return n;
+}
+
+bool IsNodePure(Node *node) {
+    if (!node)
+        return true;
+
+    switch (node->kind) {
+    case ND_NUM:
+    case ND_VAR:
+        return true;
+    case ND_ASSIGN:
+    case ND_FNCALL:
+    case ND_STMT_EXPR:
+        return false;
+    }
+    return IsNodePure(node->lhs) && IsNodePure(node->rhs);
+}
+
+static Node *new_num(Node *orig, int64_t val) {
+    Node *node = FnAlloc(sizeof(Node));
+    node->kind = ND_NUM;
+    node->tok = orig->tok;
+    node->type = orig->type;
+    node->val = is_wide(orig->type) ? val : (int32_t)val;
+    return node;
+}
+
+//===================================================================
+// Escape analysis
+//===================================================================
+// A local can be kept out of memory if it is a scalar whose address is
+// never taken. is_escaped is set for every variable that is evaluated for its
+// address rather than its value.
+static void find_escaped(Node *node, bool addr, int weight) {
+    if (!node)
+        return;
+
+    switch (node->kind) {
+    case ND_VAR:
+        if (addr)
+            node->var->is_escaped = true;
+        node->var->use_count += weight;
+        return;
+    case ND_ADDR:
+    case ND_DOTS:
+        find_escaped(node->lhs, true, weight);
+        return;
+    case ND_COMMA:
+        find_escaped(node->lhs, false, weight);
+        find_escaped(node->rhs, addr, weight);
+        return;
+    case ND_ASSIGN:
+        find_escaped(node->lhs, node->lhs->kind != ND_VAR, weight);
+        find_escaped(node->rhs, false, weight);
+        return;
+    case ND_FOR:
+        weight *= 8;
+        break;
+    }
+
+    find_escaped(node->lhs, false, weight);
+    find_escaped(node->rhs, false, weight);
+    find_escaped(node->cond, false, weight);
+    find_escaped(node->then, false, weight);
+    find_escaped(node->_else, false, weight);
+    find_escaped(node->init, false, weight);
+    find_escaped(node->inc, false, weight);
+    for (Node *n = node->body; n; n = n->next)
+        find_escaped(n, false, weight);
+    for (Node *n = node->args; n; n = n->next)
+        find_escaped(n, false, weight);
+}
+
+// Sets is_escaped and use_count of the locals of fn. Uses inside loops
+// weigh more.
+void MarkEscapedLVars(Obj *fn) {
+    for (Obj *lv = fn->locals; lv; lv = lv->next) {
+        lv->is_escaped = false;
+        lv->use_count = 0;
+    }
+    for (Node *n = fn->body; n; n = n->next)
+        find_escaped(n, false, 1);
+}
+
+//===================================================================
+// Constant folding
+//===================================================================
+static bool eval_binary(Node *node, int64_t *val) {
+    int64_t l = node->lhs->val;
+    int64_t r = node->rhs->val;
+    if (!is_wide(node->lhs->type)) {
+        l = (int32_t)l;
+        r = (int32_t)r;
+    }
+
+    switch (node->kind) {
+    case ND_ADD: *val = (uint64_t)l + r; return true;
+    case ND_SUB: *val = (uint64_t)l - r; return true;
+    case ND_MUL: *val = (uint64_t)l * r; return true;
+    case ND_AND: *val = l & r; return true;
+    case ND_SHL: *val = (uint64_t)l << r; return true;
+    case ND_EQ: *val = l == r; return true;
+    case ND_NE: *val = l != r; return true;
+    case ND_LT: *val = l < r; return true;
+    case ND_LE: *val = l <= r; return true;
+    case ND_DIV:
+    case ND_MOD:
+        if (r == 0 || (r == -1 && l == INT64_MIN))
+            return false;
+        *val = node->kind == ND_DIV ? l / r : l % r;
+        return true;
+    }
+    return false;
+}
+
+// Replacing a node by one of its operands is only safe if it does not
+// change whether the parent computes in 32 or 64 bits.
+static Node *same_width(Node *node, Node *operand) {
+    if (is_wide(node->type) == is_wide(operand->type))
+        return operand;
+    return node;
+}
+
+static Node *simplify(Node *node) {
+    Node *lhs = node->lhs;
+    Node *rhs = node->rhs;
+
+    switch (node->kind) {
+    case ND_ADD:
+        if (is_num_val(rhs, 0))
+            return same_width(node, lhs);
+        if (is_num_val(lhs, 0))
+            return same_width(node, rhs);
+
+        // (x + c1) + c2 => x + (c1 + c2)
+        if (is_num(rhs) && lhs->kind == ND_ADD && is_num(lhs->rhs) &&
+            is_wide(lhs->type) == is_wide(node->type)) {
+            node->lhs = lhs->lhs;
+            node->rhs = new_num(node, (uint64_t)lhs->rhs->val + rhs->val);
+            return simplify(node);
+        }
+        return node;
+    case ND_SUB:
+        if (is_num_val(rhs, 0))
+            return same_width(node, lhs);
+        return node;
+    case ND_MUL: {
+        if (is_num(lhs) && !is_num(rhs)) {
+            if (is_wide(lhs->type) != is_wide(rhs->type))
+                return node;
+            node->lhs = rhs;
+            node->rhs = lhs;
+            lhs = node->lhs;
+            rhs = node->rhs;
+        }
+        if (is_num_val(rhs, 1))
+            return same_width(node, lhs);
+        if (is_num_val(rhs, 0) && IsNodePure(lhs))
+            return new_num(node, 0);
+
+        // x * 2^n => x << n
+        int n = is_num(rhs) ? log2_of(rhs->val) : -1;
+        if (n > 0) {
+            node->kind = ND_SHL;
+            node->rhs = new_num(rhs, n);
+        }
+        return node;
+    }
+    case ND_DIV:
+        if (is_num_val(rhs, 1))
+            return same_width(node, lhs);
+        return node;
+    case ND_MOD:
+        if (is_num_val(rhs, 1) && IsNodePure(lhs))
+            return new_num(node, 0);
+        return node;
+    case ND_AND:
+        if (is_num_val(rhs, 0) && IsNodePure(lhs))
+            return new_num(node, 0);
+        if (is_num_val(rhs, -1))
+            return same_width(node, lhs);
+        return node;
+    }
+    return node;
+}
+
+//===================================================================
+// Code motion
+//===================================================================
+static Obj *cur_fn;
+
+// Locals assigned by the code an expression is moved across.
+static Obj **killed;
+static int nkilled;
+static int cap_killed;
+
+static bool is_scalar(Type *ty) {
+    return IsTypeInteger(ty) || ty->kind == TY_PTR;
+}
+
+static void kill_vars(Node *node) {
+    if (!node)
+        return;
+    if (node->kind == ND_ASSIGN && node->lhs->kind == ND_VAR) {
+        if (nkilled == cap_killed) {
+            cap_killed = cap_killed ? cap_killed * 2 : 64;
+            killed = realloc(killed, sizeof(Obj *) * cap_killed);
+            if (!killed)
+                Error("out of memory");
+        }
+        killed[nkilled++] = node->lhs->var;
+    }
+    kill_vars(node->lhs);
+    kill_vars(node->rhs);
+    kill_vars(node->cond);
+    kill_vars(node->then);
+    kill_vars(node->_else);
+    kill_vars(node->init);
+    kill_vars(node->inc);
+    for (Node *n = node->body; n; n = n->next)
+        kill_vars(n);
+    for (Node *n = node->args; n; n = n->next)
+        kill_vars(n);
+}
+
+static bool is_killed(Obj *var) {
+    for (int i = 0; i < nkilled; i++)
+        if (killed[i] == var)
+            return true;
+    return false;
+}
+
+// An expression can be moved if it reads neither memory nor a killed
+// local, and it can be evaluated even where it would not have been:
+// division is only allowed by constants that cannot trap.
+static bool is_movable(Node *node) {
+    switch (node->kind) {
+    case ND_NUM:
+        return true;
+    case ND_VAR: {
+        Obj *var = node->var;
+        if (var->type->kind == TY_ARRAY)
+            return true;
+        return var->is_lvar && !var->is_escaped && is_scalar(var->type) &&
+               !is_killed(var);
+    }
+    case ND_NEG:
+        return is_movable(node->lhs);
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_AND:
+    case ND_SHL:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+        return is_movable(node->lhs) && is_movable(node->rhs);
+    case ND_DIV:
+    case ND_MOD:
+        return is_num(node->rhs) && node->rhs->val != 0 && node->rhs->val != -1 &&
+               is_movable(node->lhs);
+    }
+    return false;
+}
+
+// Constants and variables are as cheap to use as a temporary. Pointer
+// arithmetic on an array has the array type, but its value is a pointer.
+static bool is_worth_moving(Node *node) {
+    if (node->kind == ND_NUM || node->kind == ND_VAR || !node->type)
+        return false;
+    return is_scalar(node->type) || node->type->kind == TY_ARRAY;
+}
+
+static Node *new_var(Obj *var, Token *tok) {
+    Node *node = FnAlloc(sizeof(Node));
+    node->kind = ND_VAR;
+    node->tok = tok;
+    node->var = var;
+    node->type = var->type;
+    return node;
+}
+
+static Node *new_stmt(NodeKind kind, Node *lhs, Token *tok) {
+    Node *node = FnAlloc(sizeof(Node));
+    node->kind = kind;
+    node->tok = tok;
+    node->lhs = lhs;
+    return node;
+}
+
+static Obj *new_lvar(Type *type, char *name) {
+    Obj *var = FnAlloc(sizeof(Obj));
+    var->name = name;
+    var->type = type;
+    var->is_lvar = true;
+    var->next = cur_fn->locals;
+    cur_fn->locals = var;
+    return var;
+}
+
+static Node *new_assign_stmt(Obj *var, Node *expr) {
+    Node *assign = new_stmt(ND_ASSIGN, new_var(var, expr->tok), expr->tok);
+    assign->rhs = expr;
+    assign->type = var->type;
+    return new_stmt(ND_EXPR_STMT, assign, expr->tok);
+}
+
+// Returns a statement that assigns expr to a new local of the current
+// function. Arithmetic on narrow integers keeps the type of its operand
+// but not its range, so the temporary is at least as wide as an int.
+static Node *new_temp(Node *expr, char *name) {
+    Type *type = expr->type;
+    if (type->kind == TY_ARRAY)
+        type = NewTypePTR2(type->base);
+    else if (IsTypeInteger(type) && type->size < ty_int->size)
+        type = ty_int;
+    return new_assign_stmt(new_lvar(type, name), expr);
+}
+
+// Replaces *p, which is part of a list, by a read of var.
+static void replace_by_var(Node **p, Obj *var) {
+    Node *node = *p;
+    *p = new_var(var, node->tok);
+    (*p)->next = node->next;
+}
+
+//===================================================================
+// Inlining
+//===================================================================
+// Callees with at most this many nodes are inlined.
+#define INLINE_THRESHOLD 40
+
+static Obj *prog_objs;
+
+// Locals of the callee being inlined and their copies in the caller, or
+// the argument that replaces a parameter.
+static Obj **inline_from;
+static Obj **inline_to;
+static Node **inline_arg;
+static int inline_nvars;
+
+static int count_nodes(Node *node) {
+    if (!node)
+        return 0;
+    int n = 1 + count_nodes(node->lhs) + count_nodes(node->rhs) +
+            count_nodes(node->cond) + count_nodes(node->then) +
+            count_nodes(node->_else) + count_nodes(node->init) +
+            count_nodes(node->inc);
+    for (Node *b = node->body; b; b = b->next)
+        n += count_nodes(b);
+    for (Node *a = node->args; a; a = a->next)
+        n += count_nodes(a);
+    return n;
+}
+
+static bool has_return(Node *node) {
+    if (!node)
+        return false;
+    if (node->kind == ND_RETURN)
+        return true;
+    if (has_return(node->lhs) || has_return(node->rhs) || has_return(node->cond) ||
+        has_return(node->then) || has_return(node->_else) ||
+        has_return(node->init) || has_return(node->inc))
+        return true;
+    for (Node *n = node->body; n; n = n->next)
+        if (has_return(n))
+            return true;
+    return false;
+}
+
+static bool calls(Node *node, char *name) {
+    if (!node)
+        return false;
+    if (node->kind == ND_FNCALL && node->fn_name == name)
+        return true;
+    if (calls(node->lhs, name) || calls(node->rhs, name) || calls(node->cond, name) ||
+        calls(node->then, name) || calls(node->_else, name) ||
+        calls(node->init, name) || calls(node->inc, name))
+        return true;
+    for (Node *n = node->body; n; n = n->next)
+        if (calls(n, name))
+            return true;
+    for (Node *n = node->args; n; n = n->next)
+        if (calls(n, name))
+            return true;
+    return false;
+}
+
+// A callee can be inlined if it is small, not recursive and returns only
+// from its outermost block, so that its body becomes a statement
+// expression.
+static Obj *find_inline_callee(Node *node) {
+    for (Obj *fn = prog_objs; fn; fn = fn->next) {
+        if (!fn->is_func || !fn->is_def || fn->name != node->fn_name)
+            continue;
+
+        int nparams = 0;
+        for (Obj *var = fn->params; var; var = var->next)
+            nparams++;
+        int nargs = 0;
+        for (Node *arg = node->args; arg; arg = arg->next)
+            nargs++;
+        if (nparams != nargs || fn->body->kind != ND_BLOCK ||
+            count_nodes(fn->body) > INLINE_THRESHOLD || calls(fn->body, fn->name))
+            return NULL;
+
+        for (Node *stmt = fn->body->body; stmt; stmt = stmt->next) {
+            if (stmt->kind == ND_RETURN)
+                break;
+            if (has_return(stmt))
+                return NULL;
+        }
+        return fn;
+    }
+    return NULL;
+}
+
+static Obj *clone_var(Obj *var) {
+    for (int i = 0; i < inline_nvars; i++)
+        if (inline_from[i] == var)
+            return inline_to[i];
+    return var;
+}
+
+static Node *clone_node(Node *node);
+
+// Whether storing value to an object of type ty leaves it unchanged.
+static bool fits_type(Node *value, Type *ty) {
+    if (!IsTypeInteger(ty) || ty->size == 8)
+        return true;
+    if (value->kind == ND_NUM)
+        return value->val == (ty->size == 1 ? (int8_t)value->val :
+                              ty->size == 2 ? (int16_t)value->val : (int32_t)value->val);
+    return IsTypeInteger(value->type) && value->type->size <= ty->size;
+}
+
+// A parameter that the callee never assigns can be replaced by its
+// argument if that is a constant that the parameter can hold unchanged,
+// or a local of the same type that the callee cannot reach.
+static Node *substitute_arg(Obj *param, Node *arg, Obj *callee) {
+    nkilled = 0;
+    kill_vars(callee->body);
+    if (param->is_escaped || is_killed(param) || !is_scalar(param->type))
+        return NULL;
+    if (arg->kind == ND_NUM && arg->val == (int32_t)arg->val && fits_type(arg, param->type)) {
+        Node *node = new_num(arg, arg->val);
+        node->type = param->type;
+        return node;
+    }
+    if (arg->kind == ND_VAR && arg->var->is_lvar && !arg->var->is_escaped &&
+        arg->type->kind == param->type->kind && arg->type->size == param->type->size)
+        return arg;
+    return NULL;
+}
+
+static Node *clone_node(Node *node) {
+    if (!node)
+        return NULL;
+
+    if (node->kind == ND_VAR) {
+        for (int i = 0; i < inline_nvars; i++) {
+            if (inline_from[i] == node->var && inline_arg[i]) {
+                Node *copy = FnAlloc(sizeof(Node));
+                *copy = *inline_arg[i];
+                copy->tok = node->tok;
+                copy->next = NULL;
+                return copy;
+            }
+        }
+    }
+
+    Node *copy = FnAlloc(sizeof(Node));
+    *copy = *node;
+    copy->next = NULL;
+    if (copy->var)
+        copy->var = clone_var(copy->var);
+    if (copy->ret_buffer)
+        copy->ret_buffer = clone_var(copy->ret_buffer);
+    copy->lhs = clone_node(node->lhs);
+    copy->rhs = clone_node(node->rhs);
+    copy->cond = clone_node(node->cond);
+    copy->then = clone_node(node->then);
+    copy->_else = clone_node(node->_else);
+    copy->init = clone_node(node->init);
+    copy->inc = clone_node(node->inc);
+
+    Node **tail = &copy->body;
+    for (Node *n = node->body; n; n = n->next)
+        tail = &(*tail = clone_node(n))->next;
+    tail = &copy->args;
+    for (Node *n = node->args; n; n = n->next)
+        tail = &(*tail = clone_node(n))->next;
+    return copy;
+}
+
+// f(args) => ({ params = args; body; expr; })
+//
+// The statement expression keeps the type of the call, so the caller
+// reads the value of expr just as it would have read %rax.
+static Node *inline_call(Node *node, Obj *callee) {
+    inline_nvars = 0;
+    for (Obj *var = callee->locals; var; var = var->next)
+        inline_nvars++;
+    inline_from = realloc(inline_from, sizeof(Obj *) * inline_nvars);
+    inline_to = realloc(inline_to, sizeof(Obj *) * inline_nvars);
+    inline_arg = realloc(inline_arg, sizeof(Node *) * inline_nvars);
+
+    int i = 0;
+    for (Obj *var = callee->locals; var; var = var->next, i++) {
+        inline_from[i] = var;
+        inline_to[i] = NULL;
+        inline_arg[i] = NULL;
+    }
+
+    // The parameters come last in the list of locals.
+    int nparams = 0;
+    for (Obj *param = callee->params; param; param = param->next)
+        nparams++;
+    Node *arg = node->args;
+    for (i = inline_nvars - nparams; i < inline_nvars; i++, arg = arg->next)
+        inline_arg[i] = substitute_arg(inline_from[i], arg, callee);
+
+    for (i = 0; i < inline_nvars; i++)
+        if (!inline_arg[i])
+            inline_to[i] = new_lvar(inline_from[i]->type, inline_from[i]->name);
+
+    Node head = {};
+    Node **tail = &head.next;
+    arg = node->args;
+    for (i = inline_nvars - nparams; i < inline_nvars; i++, arg = arg->next)
+        if (!inline_arg[i])
+            tail = &(*tail = new_assign_stmt(inline_to[i], arg))->next;
+
+    Node *value = NULL;
+    for (Node *stmt = callee->body->body; stmt; stmt = stmt->next) {
+        if (stmt->kind == ND_RETURN) {
+            value = clone_node(stmt->lhs);
+            break;
+        }
+        tail = &(*tail = clone_node(stmt))->next;
+    }
+    if (!value)
+        value = new_num(node, 0);
+
+    // A call converts the value to the return type, which for a narrow
+    // integer is what storing it to a local of that type does.
+    if (!fits_type(value, node->type)) {
+        Obj *ret = new_lvar(node->type, "ret");
+        tail = &(*tail = new_assign_stmt(ret, value))->next;
+        value = new_var(ret, node->tok);
+    }
+    *tail = new_stmt(ND_EXPR_STMT, value, node->tok);
+
+    Node *expr = new_stmt(ND_STMT_EXPR, NULL, node->tok);
+    expr->body = head.next;
+    expr->type = node->type;
+    expr->next = node->next;
+    return expr;
+}
+
+// Call sites in inlined bodies are left alone, so this terminates even
+// for mutually recursive callees.
+static void inline_calls(Node **p) {
+    Node *node = *p;
+    if (!node)
+        return;
+
+    inline_calls(&node->lhs);
+    inline_calls(&node->rhs);
+    inline_calls(&node->cond);
+    inline_calls(&node->then);
+    inline_calls(&node->_else);
+    inline_calls(&node->init);
+    inline_calls(&node->inc);
+    for (Node **n = &node->body; *n; n = &(*n)->next)
+        inline_calls(n);
+    for (Node **n = &node->args; *n; n = &(*n)->next)
+        inline_calls(n);
+
+    if (node->kind == ND_FNCALL) {
+        Obj *callee = find_inline_callee(node);
+        if (callee && callee != cur_fn)
+            *p = inline_call(node, callee);
+    }
+}
+
+//===================================================================
+// Loop-invariant code motion
+//===================================================================
+static bool is_same_expr(Node *a, Node *b);
+
+// Replaces the invariant subexpressions of *p by temporaries that are
+// assigned by statements appended to *hoisted. An expression that occurs
+// more than once shares a temporary.
+static void hoist(Node **p, Node *head, Node ***hoisted) {
+    Node *node = *p;
+    if (!node)
+        return;
+
+    if (is_worth_moving(node) && is_movable(node)) {
+        for (Node *stmt = head->next; stmt; stmt = stmt->next) {
+            if (is_same_expr(stmt->lhs->rhs, node)) {
+                replace_by_var(p, stmt->lhs->lhs->var);
+                return;
+            }
+        }
+        Node *stmt = new_temp(node, "licm.tmp");
+        replace_by_var(p, stmt->lhs->lhs->var);
+        node->next = NULL;
+        **hoisted = stmt;
+        *hoisted = &stmt->next;
+        return;
+    }
+
+    if (node->kind != ND_ASSIGN || node->lhs->kind != ND_VAR)
+        hoist(&node->lhs, head, hoisted);
+    hoist(&node->rhs, head, hoisted);
+    hoist(&node->cond, head, hoisted);
+    hoist(&node->then, head, hoisted);
+    hoist(&node->_else, head, hoisted);
+    hoist(&node->init, head, hoisted);
+    hoist(&node->inc, head, hoisted);
+    for (Node **n = &node->body; *n; n = &(*n)->next)
+        hoist(n, head, hoisted);
+    for (Node **n = &node->args; *n; n = &(*n)->next)
+        hoist(n, head, hoisted);
+}
+
+// Moves invariant computations of a loop in front of it. Nested loops have
+// already been processed, so what they hoisted may move further out.
+static Node *licm(Node *node) {
+    Node head = {};
+    Node **hoisted = &head.next;
+
+    nkilled = 0;
+    kill_vars(node->cond);
+    kill_vars(node->then);
+    kill_vars(node->inc);
+
+    // A comparison in the condition is better left to the branch.
+    if (node->cond && is_binary_cmp(node->cond)) {
+        hoist(&node->cond->lhs, &head, &hoisted);
+        hoist(&node->cond->rhs, &head, &hoisted);
+    } else {
+        hoist(&node->cond, &head, &hoisted);
+    }
+    hoist(&node->then, &head, &hoisted);
+    hoist(&node->inc, &head, &hoisted);
+    if (!head.next)
+        return node;
+
+    // { init; hoisted...; for (; cond; inc) then }
+    Node *block = new_stmt(ND_BLOCK, NULL, node->tok);
+    Node **tail = &block->body;
+    if (node->init) {
+        *tail = node->init;
+        tail = &node->init->next;
+        node->init = NULL;
+    }
+    *tail = head.next;
+    *hoisted = node;
+    block->next = node->next;
+    node->next = NULL;
+    return block;
+}
+
+//===================================================================
+// Folding
+//===================================================================
+static Node *fold(Node *node);
+
+static void fold_list(Node **list) {
+    for (Node **n = list; *n; n = &(*n)->next) {
+        Node *next = (*n)->next;
+        *n = fold(*n);
+        (*n)->next = next;
+    }
+}
+
+static Node *fold(Node *node) {
+    if (!node)
+        return NULL;
+
+    node->lhs = fold(node->lhs);
+    node->rhs = fold(node->rhs);
+    node->cond = fold(node->cond);
+    node->then = fold(node->then);
+    node->_else = fold(node->_else);
+    node->init = fold(node->init);
+    node->inc = fold(node->inc);
+    fold_list(&node->body);
+    fold_list(&node->args);
+
+    switch (node->kind) {
+    case ND_FOR:
+        return licm(node);
+    case ND_NEG:
+        if (is_num(node->lhs))
+            return new_num(node, -(uint64_t)node->lhs->val);
+        return node;
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_MOD:
+    case ND_AND:
+    case ND_SHL:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE: {
+        int64_t val;
+        if (is_num(node->lhs) && is_num(node->rhs) && eval_binary(node, &val))
+            return new_num(node, val);
+        return simplify(node);
+    }
+    }
+    return node;
+}
+
+//===================================================================
+// Common subexpression elimination
+//===================================================================
+static bool is_same_expr(Node *a, Node *b) {
+    if (a->kind != b->kind || !b->type || a->type->kind != b->type->kind ||
+        a->type->size != b->type->size)
+        return false;
+
+    switch (a->kind) {
+    case ND_NUM:
+        return a->val == b->val;
+    case ND_VAR:
+        return a->var == b->var;
+    case ND_NEG:
+        return is_same_expr(a->lhs, b->lhs);
+    }
+    return is_same_expr(a->lhs, b->lhs) && is_same_expr(a->rhs, b->rhs);
+}
+
+// Replaces each occurrence of expr in *p by var if var is given, and
+// returns the number of occurrences.
+static int replace_expr(Node **p, Node *expr, Obj *var) {
+    Node *node = *p;
+    if (!node)
+        return 0;
+    if (is_same_expr(expr, node)) {
+        if (var)
+            replace_by_var(p, var);
+        return 1;
+    }
+
+    int n = 0;
+    if (node->kind != ND_ASSIGN || node->lhs->kind != ND_VAR)
+        n += replace_expr(&node->lhs, expr, var);
+    n += replace_expr(&node->rhs, expr, var);
+    n += replace_expr(&node->cond, expr, var);
+    n += replace_expr(&node->then, expr, var);
+    n += replace_expr(&node->_else, expr, var);
+    n += replace_expr(&node->init, expr, var);
+    n += replace_expr(&node->inc, expr, var);
+    for (Node **n2 = &node->body; *n2; n2 = &(*n2)->next)
+        n += replace_expr(n2, expr, var);
+    for (Node **n2 = &node->args; *n2; n2 = &(*n2)->next)
+        n += replace_expr(n2, expr, var);
+    return n;
+}
+
+static bool is_simple_stmt(Node *node) {
+    return node->kind == ND_EXPR_STMT || node->kind == ND_RETURN;
+}
+
+// If expr, taken from the statement at *p, is computed more than once by
+// the statements that follow without anything in between changing its
+// value, computes it once into a temporary in front of them.
+static bool eliminate(Node *expr, Node **p) {
+    Node *end = *p;
+    int uses = 0;
+
+    nkilled = 0;
+    for (Node *stmt = *p; stmt && is_simple_stmt(stmt); stmt = stmt->next) {
+        kill_vars(stmt);
+        if (!is_movable(expr))
+            break;
+        uses += replace_expr(&stmt->lhs, expr, NULL);
+        end = stmt->next;
+        if (stmt->kind == ND_RETURN)
+            break;
+    }
+    if (uses < 2)
+        return false;
+
+    Node *copy = FnAlloc(sizeof(Node));
+    *copy = *expr;
+    copy->next = NULL;
+    Node *tmp = new_temp(copy, "cse.tmp");
+    for (Node *stmt = *p; stmt != end; stmt = stmt->next)
+        replace_expr(&stmt->lhs, copy, tmp->lhs->lhs->var);
+    tmp->next = *p;
+    *p = tmp;
+    return true;
+}
+
+// Tries the subexpressions of node, larger ones first.
+static bool eliminate_any(Node *node, Node **p) {
+    if (!node)
+        return false;
+    if (is_worth_moving(node) && eliminate(node, p))
+        return true;
+
+    if (node->kind != ND_ASSIGN || node->lhs->kind != ND_VAR)
+        if (eliminate_any(node->lhs, p))
+            return true;
+    if (eliminate_any(node->rhs, p) || eliminate_any(node->cond, p) ||
+        eliminate_any(node->then, p) || eliminate_any(node->_else, p) ||
+        eliminate_any(node->init, p) || eliminate_any(node->inc, p))
+        return true;
+    for (Node *n = node->body; n; n = n->next)
+        if (eliminate_any(n, p))
+            return true;
+    for (Node *n = node->args; n; n = n->next)
+        if (eliminate_any(n, p))
+            return true;
+    return false;
+}
+
+static void cse(Node *node);
+
+static void cse_list(Node **list) {
+    for (Node **p = list; *p; p = &(*p)->next) {
+        cse(*p);
+        if (!is_simple_stmt(*p))
+            continue;
+        while (eliminate_any((*p)->lhs, p))
+            p = &(*p)->next;
+    }
+}
+
+static void cse(Node *node) {
+    if (!node)
+        return;
+    cse(node->lhs);
+    cse(node->rhs);
+    cse(node->cond);
+    cse(node->then);
+    cse(node->_else);
+    cse(node->init);
+    cse(node->inc);
+    cse_list(&node->body);
+    for (Node *n = node->args; n; n = n->next)
+        cse(n);
+}
+
+//===================================================================
+// Dead code elimination
+//===================================================================
+// Set if a store has been removed, since that may leave more locals unread.
+static bool removed_store;
+
+// True if control never reaches the end of the statement. There is no
+// break or goto, so a loop without a condition never exits.
+static bool is_terminal(Node *node) {
+    switch (node->kind) {
+    case ND_RETURN:
+        return true;
+    case ND_BLOCK:
+        for (Node *n = node->body; n; n = n->next)
+            if (is_terminal(n))
+                return true;
+        return false;
+    case ND_IF:
+        return node->_else && is_terminal(node->then) && is_terminal(node->_else);
+    case ND_FOR:
+        return !node->cond || (is_num(node->cond) && node->cond->val);
+    }
+    return false;
+}
+
+static bool is_read(Node *node, Obj *var) {
+    if (!node)
+        return false;
+    if (node->kind == ND_VAR)
+        return node->var == var;
+    if (node->kind == ND_ASSIGN && node->lhs->kind == ND_VAR)
+        return is_read(node->rhs, var);
+    if (is_read(node->lhs, var) || is_read(node->rhs, var) || is_read(node->cond, var) ||
+        is_read(node->then, var) || is_read(node->_else, var) ||
+        is_read(node->init, var) || is_read(node->inc, var))
+        return true;
+    for (Node *n = node->body; n; n = n->next)
+        if (is_read(n, var))
+            return true;
+    for (Node *n = node->args; n; n = n->next)
+        if (is_read(n, var))
+            return true;
+    return false;
+}
+
+// x = expr; where x is never read.
+static bool is_dead_store(Node *node) {
+    if (node->kind != ND_EXPR_STMT || node->lhs->kind != ND_ASSIGN ||
+        node->lhs->lhs->kind != ND_VAR)
+        return false;
+    Obj *var = node->lhs->lhs->var;
+    return var->is_lvar && !var->is_escaped && is_scalar(var->type) &&
+           !is_read(cur_fn->body, var);
+}
+
+static bool is_empty_stmt(Node *node) {
+    if (node->kind == ND_BLOCK)
+        return !node->body;
+    return node->kind == ND_EXPR_STMT && IsNodePure(node->lhs);
+}
+
+static Node *dce(Node *node);
+
+// The last statement of a statement expression gives its value, so it is
+// kept even if it looks useless.
+static void dce_list(Node **list, bool keep_last) {
+    for (Node **p = list; *p;) {
+        Node *next = (*p)->next;
+        *p = dce(*p);
+        (*p)->next = next;
+        if (keep_last && !next)
+            return;
+
+        if (is_dead_store(*p)) {
+            (*p)->lhs = (*p)->lhs->rhs;
+            removed_store = true;
+        }
+        if (is_empty_stmt(*p)) {
+            *p = next;
+            continue;
+        }
+        if (is_terminal(*p) && !keep_last) {
+            (*p)->next = NULL;
+            return;
+        }
+        p = &(*p)->next;
+    }
+}
+
+static Node *dce(Node *node) {
+    if (!node)
+        return NULL;
+
+    node->lhs = dce(node->lhs);
+    node->rhs = dce(node->rhs);
+    node->cond = dce(node->cond);
+    node->then = dce(node->then);
+    node->_else = dce(node->_else);
+    node->init = dce(node->init);
+    node->inc = dce(node->inc);
+    dce_list(&node->body, node->kind == ND_STMT_EXPR);
+    for (Node **a = &node->args; *a; a = &(*a)->next) {
+        Node *next = (*a)->next;
+        *a = dce(*a);
+        (*a)->next = next;
+    }
+
+    switch (node->kind) {
+    case ND_IF:
+        if (is_num(node->cond)) {
+            Node *taken = node->cond->val ? node->then : node->_else;
+            return taken ? taken : new_stmt(ND_BLOCK, NULL, node->tok);
+        }
+        return node;
+    case ND_FOR:
+        if (node->cond && is_num_val(node->cond, 0))
+            return node->init ? node->init : new_stmt(ND_BLOCK, NULL, node->tok);
+        return node;
+    }
+    return node;
+}
+
+// Drops locals that are no longer referenced so that they take no space in
+// the frame. Parameters are the tail of the list and always stay.
+static void remove_unused_lvars(Obj *fn) {
+    for (Obj **lv = &fn->locals; *lv && *lv != fn->params;) {
+        if (!(*lv)->use_count && is_scalar((*lv)->type))
+            *lv = (*lv)->next;
+        else
+            lv = &(*lv)->next;
+    }
+}
+
+//===================================================================
+void Optimize(Obj *prog) {
+    prog_objs = prog;
+    for (Obj *fn = prog; fn; fn = fn->next)
+        if (fn->is_func && fn->is_def)
+            MarkEscapedLVars(fn);
+
+    for (Obj *fn = prog; fn; fn = fn->next) {
+        if (!fn->is_func || !fn->is_def || OptNoInline)
+            continue;
+        cur_fn = fn;
+        FnArena = fn->arena;
+        inline_calls(&fn->body);
+    }
+
+    for (Obj *fn = prog; fn; fn = fn->next) {
+        if (!fn->is_func || !fn->is_def)
+            continue;
+        cur_fn = fn;
+        FnArena = fn->arena;
+        MarkEscapedLVars(fn);
+        fold_list(&fn->body);
+        cse_list(&fn->body);
+
+        do {
+            removed_store = false;
+            dce_list(&fn->body, false);
+            MarkEscapedLVars(fn);
+        } while (removed_store);
+        remove_unused_lvars(fn);
+    }
+    FnArena = NULL;
+}
@@ -7,20 +7,19 @@
 
 
 //===================================================================
-static bool IsTokenEqual(Token *tok, char *op) {
-    return strlen(op) == tok->len && !strncmp(tok->loc, op, tok->len);
-    // return tok->kind == TK_RESERVED && memcmp(tok->loc, op, tok->len) == 0 && op[tok->len] == '\0';
+static bool IsTokenEqual(Token *tok, TokenKind kind) {
+    return tok->kind == kind;
 }
 
-static Token *SkipToken(Token *tok, char *s) {
-  if (!IsTokenEqual(tok, s))
-    ErrorToken(tok, "expected '%s'", s);
-  return tok->next;
+static Token *SkipToken(Token *tok, TokenKind kind) {
+  if (!IsTokenEqual(tok, kind))
+    ErrorToken(tok, "expected '%s'", TokenSpelling(kind));
+  return tok + 1;
 }
 
-static bool ConsumeToken(Token **rest, Token *tok, char *op) {
-    if (IsTokenEqual(tok, op)) {
-        *rest = tok->next;
+static bool ConsumeToken(Token **rest, Token *tok, TokenKind kind) {
+    if (IsTokenEqual(tok, kind)) {
+        *rest = tok + 1;
         return true;
     }
     *rest = tok;
@@ -33,21 +32,31 @@ static bool IsTokenAtEof(Token *tok) {
 
 static char *NewUniqueName(void) {
     static int count = 0;
-    char *name = calloc(sizeof(char), 16);
+    char *name = Alloc(16);
     sprintf(name, ".L.L.%d", count++);
     return name;
 }
 
-static char *GetTokenIdent(Token *tok) {
+static int GetTokenIdentId(Token *tok) {
     if (tok->kind != TK_IDENT)
         ErrorToken(tok, "This is not ident");
-    return strndup(tok->loc, tok->len);
+    return tok->lit;
+}
+
+static char *GetTokenIdent(Token *tok) {
+    return IdentName(GetTokenIdentId(tok));
+}
+
+// Names the compiler makes up are interned too, so that every name in
+// scope carries the hash computed when it was interned.
+static int InternName(char *name) {
+    return InternIdent(name, strlen(name));
 }
 
 static int GetTokenNum(Token *tok) {
     if (tok->kind != TK_NUM)
         ErrorToken(tok, "This is not number");
-    return tok->val;
+    return TokenVal(tok);
 }
 
 //===================================================================
@@ -55,8 +64,14 @@ typedef struct VarScope VarScope;
 typedef struct TagScope TagScope;
 typedef struct Scope Scope;
 
+// Every visible name is in a hash table, the innermost binding first in
+// its bucket. Each scope also lists the bindings it added so that they can
+// be unlinked when it is left; being the most recent, they are always at
+// the front of their buckets.
 struct VarScope {
-    VarScope *next;
+    VarScope *next;    // in the same scope
+    VarScope *bucket;  // next in the same bucket
+    unsigned hash;
     Obj *var;
     char *name;
     Type *type_def;
@@ -64,6 +79,8 @@ struct VarScope {
 
 struct TagScope {
     TagScope *next;
+    TagScope *bucket;
+    unsigned hash;
     char *name;
     Type *type;
 };
@@ -78,47 +95,70 @@ typedef struct {
     bool is_typedef;
 } VarAttr;
 
+#define NUM_SCOPE_BUCKETS 4096
+
 static Scope *scope = &(Scope){};
+static VarScope *var_buckets[NUM_SCOPE_BUCKETS];
+static TagScope *tag_buckets[NUM_SCOPE_BUCKETS];
 
 static void EnterScope() {
-    Scope *new = calloc(1, sizeof(Scope));
+    Scope *new = Alloc(sizeof(Scope));
     new->next = scope;
     scope = new;
 }
 
 static void LeaveScope() {
+    for (VarScope *vsc = scope->vars; vsc; vsc = vsc->next)
+        var_buckets[vsc->hash % NUM_SCOPE_BUCKETS] = vsc->bucket;
+    for (TagScope *tsc = scope->tags; tsc; tsc = tsc->next)
+        tag_buckets[tsc->hash % NUM_SCOPE_BUCKETS] = tsc->bucket;
     scope = scope->next;
 }
 
-static VarScope *PushScope(char *name) {
-    VarScope *new = calloc(1, sizeof(VarScope));
-    new->name = name;
+static VarScope *PushScope(int id) {
+    VarScope *new = Alloc(sizeof(VarScope));
+    new->name = IdentName(id);
+    new->hash = IdentHash(id);
     new->next = scope->vars;
     scope->vars = new;
+
+    VarScope **bucket = &var_buckets[new->hash % NUM_SCOPE_BUCKETS];
+    new->bucket = *bucket;
+    *bucket = new;
     return new;
 }
 
-static void PushTagScope(char *name, Type *type) {
-    TagScope *new = calloc(1, sizeof(TagScope));
-    new->name = name;
+static void PushTagScope(int id, Type *type) {
+    TagScope *new = Alloc(sizeof(TagScope));
+    new->name = IdentName(id);
+    new->hash = IdentHash(id);
     new->type = type;
     new->next = scope->tags;
     scope->tags = new;
+
+    TagScope **bucket = &tag_buckets[new->hash % NUM_SCOPE_BUCKETS];
+    new->bucket = *bucket;
+    *bucket = new;
 }
 
+// Names in scope are interned, so they are compared by address.
 static Type *FindTagScope(Token *tok) {
-    for (Scope *sc = scope; sc; sc = sc->next)
-        for (TagScope *tsc = sc->tags; tsc; tsc = tsc->next)
-            if (IsTokenEqual(tok, tsc->name))
-                return tsc->type;
+    if (tok->kind != TK_IDENT)
+        return NULL;
+    char *name = IdentName(tok->lit);
+    for (TagScope *tsc = tag_buckets[IdentHash(tok->lit) % NUM_SCOPE_BUCKETS]; tsc; tsc = tsc->bucket)
+        if (tsc->name == name)
+            return tsc->type;
     return NULL;
 }
 
 static VarScope *FindVarScope(Token *tok) {
-    for (Scope *sc = scope; sc; sc = sc->next)
-        for (VarScope *vsc = sc->vars; vsc; vsc = vsc->next)
-            if (IsTokenEqual(tok, vsc->name))
-                return vsc;
+    if (tok->kind != TK_IDENT)
+        return NULL;
+    char *name = IdentName(tok->lit);
+    for (VarScope *vsc = var_buckets[IdentHash(tok->lit) % NUM_SCOPE_BUCKETS]; vsc; vsc = vsc->bucket)
+        if (vsc->name == name)
+            return vsc;
     return NULL;
 }
 
@@ -131,11 +171,14 @@ static Type *FindTypedef(Token *tok) {
     return NULL;
 }
 
+// Token kinds that start a type, as a bitset.
+static const uint64_t type_kinds =
+    1ull << TK_INT | 1ull << TK_CHAR | 1ull << TK_LONG | 1ull << TK_SHORT |
+    1ull << TK_STRUCT | 1ull << TK_UNION | 1ull << TK_VOID | 1ull << TK_TYPEDEF;
+
 static bool IsTokenType(Token *tok) {
-    char *TY[] = {"int", "char", "long", "short", "struct", "union", "void", "typedef", NULL};
-    for (int i = 0; TY[i]; i++)
-        if (IsTokenEqual(tok, TY[i]))
-            return true;
+    if (type_kinds >> tok->kind & 1)
+        return true;
     return FindTypedef(tok);
 }
 
@@ -144,7 +187,7 @@ static Obj *locals;
 static Obj *globals;
 
 static Obj *NewObj(char *name, Type *type) {
-    Obj *new = calloc(1, sizeof(Obj));
+    Obj *new = Alloc(sizeof(Obj));
     new->name = name;
     new->type = type;
     return new;
@@ -156,47 +199,52 @@ static Obj *NewObjMember(char *name, Type *type) {
     return new;
 }
 
-static Obj *NewObjVar(char *name, Type *type) {
-    Obj *new = NewObj(name, type);
-    PushScope(name)->var = new;
+static Obj *NewObjVar(int id, Type *type) {
+    Obj *new = NewObj(IdentName(id), type);
+    PushScope(id)->var = new;
     return new;
 }
 
-static Obj *NewObjLVar(char *name, Type *type) {
-    Obj *new = NewObjVar(name, type);
+// Locals go away with their function, so they come from its arena.
+static Obj *NewObjLVar(int id, Type *type) {
+    Obj *new = FnAlloc(sizeof(Obj));
+    new->name = IdentName(id);
+    new->type = type;
     new->is_lvar = true;
+    PushScope(id)->var = new;
     new->next = locals;
     locals = new;
     return new;
 }
 
-static Obj *NewObjGVar(char *name, Type *type) {
-    Obj *new = NewObjVar(name, type);
+static Obj *NewObjGVar(int id, Type *type) {
+    Obj *new = NewObjVar(id, type);
     new->next = globals;
     globals = new;
     return new;
 }
 
 static Obj *FindObjMember(Type *type, Token *tok) {
+    char *name = GetTokenIdent(tok);
     for (Obj *mem = type->members; mem; mem = mem->next)
-        if (IsTokenEqual(tok, mem->name))
+        if (mem->name == name)
             return mem;
     ErrorToken(tok, "No such member");
 }
 
 static Obj *NewObjGVarAnon(Type *type) {
-    return NewObjGVar(NewUniqueName(), type);
+    return NewObjGVar(InternName(NewUniqueName()), type);
 }
 
 static Obj *NewObjString(Token *tok) {
-    Obj *new = NewObjGVarAnon(NewTypeArrayOf(ty_char, strlen(tok->string) + 1));
-    new->init_data = tok->string;
+    Obj *new = NewObjGVarAnon(NewTypeArrayOf(ty_char, strlen(TokenStr(tok)) + 1));
+    new->init_data = TokenStr(tok);
     return new;
 }
 
 //===================================================================
 static Node *NewNodeKind(NodeKind kind, Token *tok) {
-    Node *new = calloc(1, sizeof(Node));
+    Node *new = FnAlloc(sizeof(Node));
     new->kind = kind;
     new->tok = tok;
     return new;
@@ -268,32 +316,35 @@ static Type *declspec(Token **rest, Token *tok, VarAttr *attr) {
     int counter = 0;
 
     while (IsTokenType(tok)) {
-        if (IsTokenEqual(tok, "typedef")) {
+        if (IsTokenEqual(tok, TK_TYPEDEF)) {
             if (!attr)
                 ErrorToken(tok, "storage class specifier is not allowed in this context");
             attr->is_typedef = true;
-            tok = tok->next;
+            tok++;
             continue;
         }
         Type *ty2 = FindTypedef(tok);
-        if (IsTokenEqual(tok, "struct") || IsTokenEqual(tok, "union") || ty2) {
+        if (IsTokenEqual(tok, TK_STRUCT) || IsTokenEqual(tok, TK_UNION) || ty2) {
             if (counter)
                 break;
-            if (IsTokenEqual(tok, "struct")) ty = struct_declspec(&tok, tok->next);
-            else if (IsTokenEqual(tok, "union")) ty = union_declspec(&tok, tok->next);
+            if (IsTokenEqual(tok, TK_STRUCT)) ty = struct_declspec(&tok, tok + 1);
+            else if (IsTokenEqual(tok, TK_UNION)) ty = union_declspec(&tok, tok + 1);
             else {
                 ty = ty2;
-                tok = tok->next;
+                tok++;
             }
             counter += OTHER;
             continue;
         }
 
-        if (IsTokenEqual(tok, "int")) counter += INT;
-        else if (IsTokenEqual(tok, "char")) counter += CHAR;
-        else if (IsTokenEqual(tok, "long")) counter += LONG;
-        else if (IsTokenEqual(tok, "short")) counter += SHORT;
-        else if (IsTokenEqual(tok, "void")) counter += VOID;
+        switch (tok->kind) {
+        case TK_INT: counter += INT; break;
+        case TK_CHAR: counter += CHAR; break;
+        case TK_LONG: counter += LONG; break;
+        case TK_SHORT: counter += SHORT; break;
+        case TK_VOID: counter += VOID; break;
+        default: break;
+        }
 
         switch (counter) {
         case VOID:
@@ -318,7 +369,7 @@ static Type *declspec(Token **rest, Token *tok, VarAttr *attr) {
         default:
             ErrorToken(tok, "invalid type");
         }
-        tok = tok->next;
+        tok++;
     }
     *rest = tok;
     return ty;
@@ -328,23 +379,23 @@ static Type *struion_declspec(Token **rest, Token *tok) {
     Token *tag = NULL;
     if (tok->kind == TK_IDENT) {
         tag = tok;
-        tok = tok->next;
+        tok++;
     }
 
-    if (tag && !IsTokenEqual(tok, "{")) {
+    if (tag && !IsTokenEqual(tok, TK_LBRACE)) {
         Type *type = FindTagScope(tag);
         if (!type) ErrorToken(tok, "undefined struct");
         *rest = tok;
         return type;
     }
 
-    Type *type = calloc(1, sizeof(Type));
+    Type *type = Alloc(sizeof(Type));
     type->kind = TY_STRUCT;
-    struct_members(rest, tok->next, type);
+    struct_members(rest, tok + 1, type);
     type->align = 1;
 
     if (tag)
-        PushTagScope(GetTokenIdent(tag), type);
+        PushTagScope(GetTokenIdentId(tag), type);
     return type;
 }
 
@@ -382,18 +433,18 @@ static Type *union_declspec(Token **rest, Token *tok) {
 static void struct_members(Token **rest, Token *tok, Type *type) {
     Obj head = {};
     Obj *cur = &head;
-    while (!IsTokenEqual(tok, "}")) {
+    while (!IsTokenEqual(tok, TK_RBRACE)) {
         Type *base = declspec(&tok, tok, NULL);
 
-        for (int i = 0; !ConsumeToken(&tok, tok, ";"); i++) {
+        for (int i = 0; !ConsumeToken(&tok, tok, TK_SEMICOLON); i++) {
             if (i > 0)
-                tok = SkipToken(tok, ",");
+                tok = SkipToken(tok, TK_COMMA);
 
             Type *ty = declarator(&tok, tok, base);
             cur = cur->next = NewObjMember(GetTokenIdent(ty->name), ty);
         }
     }
-    *rest = tok->next;
+    *rest = tok + 1;
     type->members = head.next;
 }
 
@@ -401,9 +452,9 @@ static Type *params(Token **rest, Token *tok, Type *ty) {
     Type head = {};
     Type *cur = &head;
 
-    while (!IsTokenEqual(tok, ")")) {
+    while (!IsTokenEqual(tok, TK_RPAREN)) {
         if (cur != &head)
-            tok = SkipToken(tok, ",");
+            tok = SkipToken(tok, TK_COMMA);
         Type *basety = declspec(&tok, tok, NULL);
         Type *ty = declarator(&tok, tok, basety);
         cur = cur->next = CopyType(ty);
@@ -411,17 +462,17 @@ static Type *params(Token **rest, Token *tok, Type *ty) {
 
     ty = NewTypeFn(ty);
     ty->params = head.next;
-    *rest = tok->next;
+    *rest = tok + 1;
     return ty;
 }
 
 static Type *type_suffix(Token **rest, Token *tok, Type *ty) {
-    if (IsTokenEqual(tok, "("))
-        return params(rest, tok->next, ty);
+    if (IsTokenEqual(tok, TK_LPAREN))
+        return params(rest, tok + 1, ty);
     
-    if (IsTokenEqual(tok, "[")) {
-        int len = GetTokenNum(tok->next);
-        tok = SkipToken(tok->next->next, "]");
+    if (IsTokenEqual(tok, TK_LBRACKET)) {
+        int len = GetTokenNum(tok + 1);
+        tok = SkipToken(tok + 2, TK_RBRACKET);
         ty = type_suffix(rest, tok, ty);
         return NewTypeArrayOf(ty, len);
     }
@@ -430,16 +481,16 @@ static Type *type_suffix(Token **rest, Token *tok, Type *ty) {
 }
 
 static Type *declarator(Token **rest, Token *tok, Type *ty) {
-    while (ConsumeToken(&tok, tok, "*"))
+    while (ConsumeToken(&tok, tok, TK_STAR))
         ty = NewTypePTR2(ty);
 
-     if (IsTokenEqual(tok, "(")) {
+     if (IsTokenEqual(tok, TK_LPAREN)) {
         Token *start = tok;
         Type dummy = {};
-        declarator(&tok, start->next, &dummy);
-        tok = SkipToken(tok, ")");
+        declarator(&tok, start + 1, &dummy);
+        tok = SkipToken(tok, TK_RPAREN);
         ty = type_suffix(rest, tok, ty);
-        return declarator(&tok, start->next, ty);
+        return declarator(&tok, start + 1, ty);
     }
     
     if (tok->kind != TK_IDENT)
@@ -447,7 +498,7 @@ static Type *declarator(Token **rest, Token *tok, Type *ty) {
 
     
 
-    ty = type_suffix(rest, tok->next, ty);
+    ty = type_suffix(rest, tok + 1, ty);
     ty->name = tok;
 
     return ty;
@@ -457,57 +508,57 @@ static Node *declaration(Token **rest, Token *tok, Type *base_type) {
     Node head = {};
     Node *cur = &head;
 
-    for (int i = 0; !IsTokenEqual(tok, ";"); i++) {
+    for (int i = 0; !IsTokenEqual(tok, TK_SEMICOLON); i++) {
         if (i > 0)
-            tok = SkipToken(tok, ",");
+            tok = SkipToken(tok, TK_COMMA);
 
         Type *ty = declarator(&tok, tok, base_type);
         if (ty->kind == TY_VOID) ErrorToken(tok, "variable declared void");
-        Obj *var = NewObjLVar(GetTokenIdent(ty->name), ty);
+        Obj *var = NewObjLVar(GetTokenIdentId(ty->name), ty);
 
-        if (!IsTokenEqual(tok, "="))
+        if (!IsTokenEqual(tok, TK_ASSIGN))
             continue;
 
         Node *lhs = NewNodeVar(tok, var);
-        Node *rhs = assign(&tok, tok->next);
+        Node *rhs = assign(&tok, tok + 1);
         Node *node = NewNodeBinary(ND_ASSIGN, tok, lhs, rhs);
         cur = cur->next = NewNodeUnary(ND_EXPR_STMT, tok, node);
     }
 
     Node *node = NewNodeKind(ND_BLOCK, tok);
     node->body = head.next;
-    *rest = tok->next;
+    *rest = tok + 1;
     return node;
 }
 
 static void create_param_lvars(Type *param) {
     if (param) {
         create_param_lvars(param->next);
-        NewObjLVar(GetTokenIdent(param->name), param);
+        NewObjLVar(GetTokenIdentId(param->name), param);
     }
 }
 
 static void parse_typedef(Token **rest, Token *tok, Type *base) {
-    for (int i = 0; !ConsumeToken(&tok, tok, ";"); i++) {
+    for (int i = 0; !ConsumeToken(&tok, tok, TK_SEMICOLON); i++) {
         if (i > 0)
-            tok = SkipToken(tok, ",");
+            tok = SkipToken(tok, TK_COMMA);
         Type *ty = declarator(&tok, tok, base);
-        PushScope(GetTokenIdent(ty->name))->type_def = ty;
+        PushScope(GetTokenIdentId(ty->name))->type_def = ty;
     }
     *rest = tok;
 }
 
 static Type *abstract_declarator(Token **rest, Token *tok, Type *ty) {
-    while (ConsumeToken(&tok, tok, "*"))
+    while (ConsumeToken(&tok, tok, TK_STAR))
         ty = NewTypePTR2(ty);
 
-     if (IsTokenEqual(tok, "(")) {
+     if (IsTokenEqual(tok, TK_LPAREN)) {
         Token *start = tok;
         Type dummy = {};
-        abstract_declarator(&tok, start->next, &dummy);
-        tok = SkipToken(tok, ")");
+        abstract_declarator(&tok, start + 1, &dummy);
+        tok = SkipToken(tok, TK_RPAREN);
         ty = type_suffix(rest, tok, ty);
-        return abstract_declarator(&tok, start->next, ty);
+        return abstract_declarator(&tok, start + 1, ty);
     }
     
     return type_suffix(rest, tok, ty);
@@ -519,55 +570,55 @@ static Type *type_name(Token **rest, Token *tok) {
 }
 
 static Node *stmt(Token **rest, Token *tok) {
-    if (IsTokenEqual(tok, "return")) {
-        Node *node = NewNodeUnary(ND_RETURN, tok, expr(&tok, tok->next));
-        *rest = SkipToken(tok, ";");
+    if (IsTokenEqual(tok, TK_RETURN)) {
+        Node *node = NewNodeUnary(ND_RETURN, tok, expr(&tok, tok + 1));
+        *rest = SkipToken(tok, TK_SEMICOLON);
         return node;
     }
-    if (IsTokenEqual(tok, "{")) {
-        return compound_stmt(rest, tok->next);
+    if (IsTokenEqual(tok, TK_LBRACE)) {
+        return compound_stmt(rest, tok + 1);
     }
-    if (IsTokenEqual(tok, "if")) {
+    if (IsTokenEqual(tok, TK_IF)) {
         Node *node = NewNodeKind(ND_IF, tok);
-        tok = SkipToken(tok->next, "(");
+        tok = SkipToken(tok + 1, TK_LPAREN);
         node->cond = expr(&tok, tok);
-        tok = SkipToken(tok, ")");
+        tok = SkipToken(tok, TK_RPAREN);
         node->then = stmt(&tok, tok);
-        if (IsTokenEqual(tok, "else"))
-            node->_else = stmt(&tok, tok->next);
+        if (IsTokenEqual(tok, TK_ELSE))
+            node->_else = stmt(&tok, tok + 1);
         *rest = tok;
         return node;
     }
-    if (IsTokenEqual(tok, "for")) {
+    if (IsTokenEqual(tok, TK_FOR)) {
         Node *node = NewNodeKind(ND_FOR, tok);
-        tok = SkipToken(tok->next, "(");
+        tok = SkipToken(tok + 1, TK_LPAREN);
 
         EnterScope();
-        if (!ConsumeToken(&tok, tok, ";")) {
+        if (!ConsumeToken(&tok, tok, TK_SEMICOLON)) {
             if (IsTokenType(tok)) {
                 Type *base = declspec(&tok, tok, NULL);
                 node->init = declaration(&tok, tok, base);
             } else
                 node->init = expr_stmt(&tok, tok);
         }
-        if (!ConsumeToken(&tok, tok, ";")) {
+        if (!ConsumeToken(&tok, tok, TK_SEMICOLON)) {
             node->cond = expr(&tok, tok);
-            tok = SkipToken(tok, ";");
+            tok = SkipToken(tok, TK_SEMICOLON);
         }
-        if (!ConsumeToken(&tok, tok, ")")) {
+        if (!ConsumeToken(&tok, tok, TK_RPAREN)) {
             node->inc = expr(&tok, tok);
-            tok = SkipToken(tok, ")");
+            tok = SkipToken(tok, TK_RPAREN);
         }
         node->then = stmt(&tok, tok);
         LeaveScope();
         *rest = tok;
         return node;
     }
-    if (IsTokenEqual(tok, "while")) {
+    if (IsTokenEqual(tok, TK_WHILE)) {
         Node *node = NewNodeKind(ND_FOR, tok);
-        tok = SkipToken(tok->next, "(");
+        tok = SkipToken(tok + 1, TK_LPAREN);
         node->cond = expr(&tok, tok);
-        tok = SkipToken(tok, ")");
+        tok = SkipToken(tok, TK_RPAREN);
         node->then = stmt(&tok, tok);
         *rest = tok;
         return node;
@@ -579,7 +630,7 @@ static Node *compound_stmt(Token **rest, Token *tok) {
     Node head  = {};
     Node *cur = &head;
     EnterScope();
-    while (!IsTokenEqual(tok, "}")) {
+    while (!IsTokenEqual(tok, TK_RBRACE)) {
         if (IsTokenType(tok)) {
             VarAttr attr = {};
             Type *base = declspec(&tok, tok, &attr);
@@ -599,24 +650,24 @@ static Node *compound_stmt(Token **rest, Token *tok) {
     LeaveScope();
     Node *node = NewNodeKind(ND_BLOCK, tok);
     node->body = head.next;
-    *rest = tok->next;
+    *rest = tok + 1;
     return node;
 }
 
 static Node *expr_stmt(Token **rest, Token *tok) {
-    if (IsTokenEqual(tok, ";")) {
-        *rest = SkipToken(tok, ";");
+    if (IsTokenEqual(tok, TK_SEMICOLON)) {
+        *rest = SkipToken(tok, TK_SEMICOLON);
         return NewNodeKind(ND_BLOCK, tok);
     }
     Node *node = NewNodeUnary(ND_EXPR_STMT, tok, expr(&tok, tok));
-   *rest = SkipToken(tok, ";");
+   *rest = SkipToken(tok, TK_SEMICOLON);
     return node;
 }
 
 static Node *expr(Token **rest, Token *tok) {
     Node *node = assign(&tok, tok);
-    if (IsTokenEqual(tok, ",")) {
-        return NewNodeBinary(ND_COMMA, tok, node, expr(rest, tok->next));
+    if (IsTokenEqual(tok, TK_COMMA)) {
+        return NewNodeBinary(ND_COMMA, tok, node, expr(rest, tok + 1));
     }
     *rest = tok;
     return node;
@@ -625,8 +676,8 @@ static Node *expr(Token **rest, Token *tok) {
 static Node *assign(Token **rest, Token *tok) {
     Node *node = equality(&tok, tok);
 
-    if (IsTokenEqual(tok, "=")) {
-        node = NewNodeBinary(ND_ASSIGN, tok, node, assign(&tok, tok->next));
+    if (IsTokenEqual(tok, TK_ASSIGN)) {
+        node = NewNodeBinary(ND_ASSIGN, tok, node, assign(&tok, tok + 1));
     }
     *rest = tok;
     return node;
@@ -636,12 +687,12 @@ static Node *equality(Token **rest, Token *tok) {
     Node *node = relational(&tok, tok);
 
     for (;;) {
-        if (IsTokenEqual(tok, "==")) {
-            node = NewNodeBinary(ND_EQ, tok, node, add(&tok, tok->next));
+        if (IsTokenEqual(tok, TK_EQ)) {
+            node = NewNodeBinary(ND_EQ, tok, node, add(&tok, tok + 1));
             continue;
         }
-        if (IsTokenEqual(tok, "!=")) {
-            node = NewNodeBinary(ND_NE, tok, node, add(&tok, tok->next));
+        if (IsTokenEqual(tok, TK_NE)) {
+            node = NewNodeBinary(ND_NE, tok, node, add(&tok, tok + 1));
             continue;
         }
         *rest = tok;
@@ -653,20 +704,20 @@ static Node *relational(Token **rest, Token *tok) {
     Node *node  = add(&tok, tok);
 
     for (;;) {
-        if (IsTokenEqual(tok, "<=")) {
-            node = NewNodeBinary(ND_LE, tok, node, add(&tok, tok->next));
+        if (IsTokenEqual(tok, TK_LE)) {
+            node = NewNodeBinary(ND_LE, tok, node, add(&tok, tok + 1));
             continue;
         }
-        if (IsTokenEqual(tok, "<")) {
-            node = NewNodeBinary(ND_LT, tok, node, add(&tok, tok->next));
+        if (IsTokenEqual(tok, TK_LT)) {
+            node = NewNodeBinary(ND_LT, tok, node, add(&tok, tok + 1));
             continue;
         }
-        if (IsTokenEqual(tok, ">=")) {
-            node = NewNodeBinary(ND_LE, tok, add(&tok, tok->next), node);
+        if (IsTokenEqual(tok, TK_GE)) {
+            node = NewNodeBinary(ND_LE, tok, add(&tok, tok + 1), node);
             continue;
         }
-        if (IsTokenEqual(tok, ">")) {
-            node = NewNodeBinary(ND_LT, tok, add(&tok, tok->next), node);
+        if (IsTokenEqual(tok, TK_GT)) {
+            node = NewNodeBinary(ND_LT, tok, add(&tok, tok + 1), node);
             continue;
         }
         *rest = tok;
@@ -718,12 +769,12 @@ static Node *add(Token **rest, Token *tok) {
     Node *node = mul(&tok, tok);
 
     for (;;) {
-        if (IsTokenEqual(tok, "+")) {
-            node = NewNodeAdd(tok, node, mul(&tok, tok->next));
+        if (IsTokenEqual(tok, TK_PLUS)) {
+            node = NewNodeAdd(tok, node, mul(&tok, tok + 1));
             continue;
         }
-        if (IsTokenEqual(tok, "-")) {
-            node = NewNodeSub(tok, node, mul(&tok, tok->next));
+        if (IsTokenEqual(tok, TK_MINUS)) {
+            node = NewNodeSub(tok, node, mul(&tok, tok + 1));
             continue;
         }
         *rest = tok;
@@ -735,20 +786,20 @@ static Node *mul(Token **rest, Token *tok) {
     Node *node = unary(&tok, tok);
 
     for (;;) {
-        if (IsTokenEqual(tok, "*")) {
-            node = NewNodeBinary(ND_MUL, tok, node, unary(&tok, tok->next));
+        if (IsTokenEqual(tok, TK_STAR)) {
+            node = NewNodeBinary(ND_MUL, tok, node, unary(&tok, tok + 1));
             continue;
         }
-        if (IsTokenEqual(tok, "/")) {
-            node = NewNodeBinary(ND_DIV, tok, node, unary(&tok, tok->next));
+        if (IsTokenEqual(tok, TK_SLASH)) {
+            node = NewNodeBinary(ND_DIV, tok, node, unary(&tok, tok + 1));
             continue;
         }
-        if (IsTokenEqual(tok, "%")) {
-            node = NewNodeBinary(ND_MOD, tok, node, unary(&tok, tok->next));
+        if (IsTokenEqual(tok, TK_PERCENT)) {
+            node = NewNodeBinary(ND_MOD, tok, node, unary(&tok, tok + 1));
             continue;
         }
-        if (IsTokenEqual(tok, "&")) {
-            node = NewNodeBinary(ND_AND, tok, node, unary(&tok, tok->next));
+        if (IsTokenEqual(tok, TK_AMP)) {
+            node = NewNodeBinary(ND_AND, tok, node, unary(&tok, tok + 1));
             continue;
         }
         *rest = tok;
@@ -757,17 +808,17 @@ static Node *mul(Token **rest, Token *tok) {
 }
 
 static Node *unary(Token **rest, Token *tok) {
-    if (IsTokenEqual(tok, "+")) {
-        return unary(rest, tok->next);
+    if (IsTokenEqual(tok, TK_PLUS)) {
+        return unary(rest, tok + 1);
     }
-    if (IsTokenEqual(tok, "-")) {
-        return NewNodeUnary(ND_NEG, tok, unary(rest, tok->next));
+    if (IsTokenEqual(tok, TK_MINUS)) {
+        return NewNodeUnary(ND_NEG, tok, unary(rest, tok + 1));
     }
-    if (IsTokenEqual(tok, "*")) {
-        return NewNodeUnary(ND_DEREF, tok, unary(rest, tok->next));
+    if (IsTokenEqual(tok, TK_STAR)) {
+        return NewNodeUnary(ND_DEREF, tok, unary(rest, tok + 1));
     }
-    if (IsTokenEqual(tok, "&")) {
-        return NewNodeUnary(ND_ADDR, tok, unary(rest, tok->next));
+    if (IsTokenEqual(tok, TK_AMP)) {
+        return NewNodeUnary(ND_ADDR, tok, unary(rest, tok + 1));
     }
     return postfix(rest, tok);
 }
@@ -776,28 +827,28 @@ static Node *struct_ref(Token *tok, Node *lhs) {
     AddType(lhs);
     if (lhs->type->kind != TY_STRUCT && lhs->type->kind != TY_UNION) ErrorToken(lhs->tok, "not a struct nor an union");
     Node *node = NewNodeUnary(ND_DOTS, tok, lhs);
-    node->member = FindObjMember(lhs->type, tok->next);
+    node->member = FindObjMember(lhs->type, tok + 1);
     return node;
 }
 
 static Node *postfix(Token **rest, Token *tok) {
     Node *node = primary(&tok, tok);
     for (;;) {
-        if (IsTokenEqual(tok, "[")) { // a[b] => *(a + b)
-            Node *index = expr(&tok, tok->next);
-            tok = SkipToken(tok, "]");
+        if (IsTokenEqual(tok, TK_LBRACKET)) { // a[b] => *(a + b)
+            Node *index = expr(&tok, tok + 1);
+            tok = SkipToken(tok, TK_RBRACKET);
             node = NewNodeUnary(ND_DEREF, tok, NewNodeAdd(tok, node, index));
             continue;
         }
-        if (IsTokenEqual(tok, ".")) {
+        if (IsTokenEqual(tok, TK_DOT)) {
             node = struct_ref(tok, node);
-            tok = tok->next->next;
+            tok += 2;
             continue;
         }
-        if (IsTokenEqual(tok, "->")) { // a->b => (*a).b
+        if (IsTokenEqual(tok, TK_ARROW)) { // a->b => (*a).b
             node = NewNodeUnary(ND_DEREF, tok, node);
             node = struct_ref(tok, node);
-            tok = tok->next->next;
+            tok += 2;
             continue;
         }
         *rest = tok;
@@ -807,70 +858,79 @@ static Node *postfix(Token **rest, Token *tok) {
 
 static Node *fncall(Token **rest, Token *tok) {
     Node *node = NewNodeKind(ND_FNCALL, tok);
-    node->fn_name = strndup(tok->loc, tok->len);
-    tok = tok->next->next;
+    node->fn_name = GetTokenIdent(tok);
+
+    // Calls to undeclared functions are assumed to return long.
+    VarScope *sc = FindVarScope(tok);
+    if (sc && sc->var && sc->var->is_func) {
+        node->func_type = sc->var->type;
+        Type *ret = node->func_type->return_type;
+        if (ret->kind == TY_STRUCT || ret->kind == TY_UNION)
+            node->ret_buffer = NewObjLVar(InternName(""), ret);
+    }
+    tok += 2;
 
     Node head = {};
     Node *cur = &head;
 
-    while (!IsTokenEqual(tok, ")")) {
+    while (!IsTokenEqual(tok, TK_RPAREN)) {
         cur = cur->next = assign(&tok, tok);
-        if (!IsTokenEqual(tok, ")"))
-            tok = SkipToken(tok, ",");
+        if (!IsTokenEqual(tok, TK_RPAREN))
+            tok = SkipToken(tok, TK_COMMA);
     }
 
-    *rest = SkipToken(tok, ")");
+    *rest = SkipToken(tok, TK_RPAREN);
     node->args = head.next;
     return node;
 }
 
 static Node *primary(Token **rest, Token *tok) {
-    if (IsTokenEqual(tok, "(")) {
-        if (IsTokenEqual(tok->next, "{")) {
+    if (IsTokenEqual(tok, TK_LPAREN)) {
+        if (IsTokenEqual(tok + 1, TK_LBRACE)) {
             Node *node = NewNodeKind(ND_STMT_EXPR, tok);
-            node->body =  compound_stmt(&tok, tok->next->next)->body;
-            *rest = SkipToken(tok, ")");
+            node->body =  compound_stmt(&tok, tok + 2)->body;
+            *rest = SkipToken(tok, TK_RPAREN);
             return node;
         } else {
-            Node *node = expr(&tok, tok->next);
-            *rest = SkipToken(tok, ")");
+            Node *node = expr(&tok, tok + 1);
+            *rest = SkipToken(tok, TK_RPAREN);
             return node;
         }
     }
-    if (IsTokenEqual(tok, "sizeof")) {
+    if (IsTokenEqual(tok, TK_SIZEOF)) {
         Token *start = tok;
-        if (IsTokenEqual(tok->next, "(") && IsTokenType(tok->next->next)) {
-            Type *base = type_name(&tok, tok->next->next);
-            *rest = SkipToken(tok, ")");
+        if (IsTokenEqual(tok + 1, TK_LPAREN) && IsTokenType(tok + 2)) {
+            Type *base = type_name(&tok, tok + 2);
+            *rest = SkipToken(tok, TK_RPAREN);
             
             return NewNodeNum(start, base->size);
         }
-        Node *node = unary(rest, tok->next);
+        Node *node = unary(rest, tok + 1);
         AddType(node);
         return NewNodeNum(tok, node->type->size);
     }
 
     if (tok->kind == TK_IDENT) {
-        if (IsTokenEqual(tok->next, "(")) {
+        if (IsTokenEqual(tok + 1, TK_LPAREN)) {
             return fncall(rest, tok);
         } else {
             VarScope *sc = FindVarScope(tok);
             if (!sc || !sc->var)
                 ErrorToken(tok, "undeclared valuable");
-            *rest = tok->next;
+            *rest = tok + 1;
             return NewNodeVar(tok, sc->var);
         }
     }
 
     if (tok->kind == TK_NUM) {
-        Node *node = NewNodeNum(tok, tok->val);
-        *rest = tok->next;
+        Node *node = NewNodeNum(tok, TokenVal(tok));
+        *rest = tok + 1;
         return node;
     }
 
     if (tok->kind == TK_STR) {
         Obj *str = NewObjString(tok);
-        *rest = tok->next;
+        *rest = tok + 1;
         return NewNodeVar(tok, str);
     }
     ErrorToken(tok, "Something is wrong");
@@ -879,38 +939,41 @@ static Node *primary(Token **rest, Token *tok) {
 static Token *Function(Token *tok, Type *base) {
     Type *ty = declarator(&tok, tok, base);
     
-    Obj *fn = NewObjGVar(GetTokenIdent(ty->name), ty);
+    Obj *fn = NewObjGVar(GetTokenIdentId(ty->name), ty);
     fn->is_func = true;
-    fn->is_def = !ConsumeToken(&tok, tok, ";");
+    fn->is_def = !ConsumeToken(&tok, tok, TK_SEMICOLON);
 
     if (!fn->is_def)
         return tok;
 
+    fn->arena = NewArena();
+    FnArena = fn->arena;
     locals = NULL;
     EnterScope();
     create_param_lvars(ty->params);
     fn->params = locals;
 
-    tok = SkipToken(tok, "{");
+    tok = SkipToken(tok, TK_LBRACE);
     fn->body = compound_stmt(&tok, tok);
     fn->locals = locals;
     
     LeaveScope();
+    FnArena = NULL;
     return tok;
 }
 
 static Token *Gvar(Token *tok, Type *base) {
-    for (int i = 0; !ConsumeToken(&tok, tok, ";"); i++) {
-        if (i > 0) tok = SkipToken(tok, ",");
+    for (int i = 0; !ConsumeToken(&tok, tok, TK_SEMICOLON); i++) {
+        if (i > 0) tok = SkipToken(tok, TK_COMMA);
 
         Type *ty = declarator(&tok, tok, base);
-        NewObjGVar(GetTokenIdent(ty->name), ty);
+        NewObjGVar(GetTokenIdentId(ty->name), ty);
     }
     return tok;
 }
 
 static bool IsFunc(Token *tok) {
-    if (IsTokenEqual(tok, ";")) return false;
+    if (IsTokenEqual(tok, TK_SEMICOLON)) return false;
 
     Type tmp = {};
     Type *ty = declarator(&tok, tok, &tmp);
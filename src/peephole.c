@@ -0,0 +1,203 @@
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "5cc.h"
+
+//===================================================================
+// Instruction buffer
+//===================================================================
+static char *copy_str(char *s, int len) {
+    char *ret = FnAlloc(len + 1);
+    memcpy(ret, s, len);
+    return ret;
+}
+
+static char *trim(char *start, char *end) {
+    while (start < end && (*start == ' ' || *start == '\t'))
+        start++;
+    while (start < end && (end[-1] == ' ' || end[-1] == '\t'))
+        end--;
+    return copy_str(start, end - start);
+}
+
+// Splits a line of assembly as printed by codegen into a label, a
+// directive (kept verbatim) or a mnemonic with its operands.
+Insn *ParseInsn(char *line) {
+    Insn *insn = FnAlloc(sizeof(Insn));
+    int len = strlen(line);
+
+    if (line[0] != '\t') {
+        if (len > 0 && line[len - 1] == ':') {
+            insn->kind = IN_LABEL;
+            insn->op = copy_str(line, len - 1);
+        } else {
+            insn->kind = IN_DIRECTIVE;
+            insn->op = copy_str(line, len);
+        }
+        return insn;
+    }
+
+    char *p = line + 1;
+    char *q = p;
+    while (*q && *q != ' ')
+        q++;
+    insn->op = copy_str(p, q - p);
+    insn->kind = insn->op[0] == '.' ? IN_DIRECTIVE : IN_INSN;
+    if (insn->kind == IN_DIRECTIVE) {
+        insn->op = copy_str(line, len);
+        return insn;
+    }
+
+    // Operands are separated by commas outside of parentheses.
+    int paren = 0;
+    for (p = q; *q; q++) {
+        if (*q == '(')
+            paren++;
+        else if (*q == ')')
+            paren--;
+        else if (*q == ',' && !paren) {
+            insn->ops[insn->nops++] = trim(p, q);
+            p = q + 1;
+        }
+    }
+    if (p < q) {
+        char *op = trim(p, q);
+        if (*op)
+            insn->ops[insn->nops++] = op;
+    }
+    return insn;
+}
+
+//===================================================================
+// Peephole optimizer
+//===================================================================
+static bool is_insn(Insn *insn, char *op) {
+    return insn && insn->kind == IN_INSN && !strcmp(insn->op, op);
+}
+
+static bool is_reg(char *op) {
+    return op[0] == '%';
+}
+
+static bool refs_rax(char *op) {
+    return strstr(op, "%rax") || strstr(op, "%eax") || strstr(op, "%ax") || strstr(op, "%al");
+}
+
+// True if insn overwrites all of %rax without reading it first.
+static bool kills_rax(Insn *insn) {
+    if (!insn || insn->kind != IN_INSN)
+        return false;
+    if (is_insn(insn, "pop"))
+        return !strcmp(insn->ops[0], "%rax");
+    if (insn->nops != 2 || refs_rax(insn->ops[0]))
+        return false;
+    if (!strcmp(insn->ops[1], "%rax"))
+        return is_insn(insn, "mov") || is_insn(insn, "movsxd") || is_insn(insn, "movsbq") ||
+               is_insn(insn, "movswq") || is_insn(insn, "lea");
+    if (!strcmp(insn->ops[1], "%eax"))
+        return is_insn(insn, "mov");
+    return false;
+}
+
+static bool is_load_rax(Insn *insn) {
+    return insn->nops == 2 && !strcmp(insn->ops[1], "%rax") &&
+           (is_insn(insn, "mov") || is_insn(insn, "movsxd") ||
+            is_insn(insn, "movsbq") || is_insn(insn, "movswq"));
+}
+
+static char *negate_set(char *op) {
+    static struct {
+        char *set;
+        char *jmp;
+    } table[] = {
+        {"sete", "jne"}, {"setne", "je"}, {"setl", "jge"},
+        {"setle", "jg"}, {"setg", "jle"}, {"setge", "jl"},
+        {NULL, NULL},
+    };
+    for (int i = 0; table[i].set; i++)
+        if (!strcmp(op, table[i].set))
+            return table[i].jmp;
+    return NULL;
+}
+
+static void replace(Insn *insn, char *op, int nops, char *op0, char *op1) {
+    insn->op = op;
+    insn->nops = nops;
+    insn->ops[0] = op0;
+    insn->ops[1] = op1;
+}
+
+// Tries to rewrite the instructions starting at *p. Returns true if anything
+// has changed.
+static bool rewrite(Insn **p) {
+    Insn *i1 = *p;
+    Insn *i2 = i1->next;
+    Insn *i3 = i2 ? i2->next : NULL;
+    Insn *i4 = i3 ? i3->next : NULL;
+
+    // mov %rax, %rax
+    if (is_insn(i1, "mov") && !strcmp(i1->ops[0], i1->ops[1])) {
+        *p = i2;
+        return true;
+    }
+
+    // push %rax; pop %rdi => mov %rax, %rdi
+    if (is_insn(i1, "push") && is_insn(i2, "pop")) {
+        replace(i1, "mov", 2, i1->ops[0], i2->ops[0]);
+        i1->next = i3;
+        return true;
+    }
+
+    // mov X, %rax; mov %rax, %rbx; <overwrite %rax> => mov X, %rbx
+    if (i1->kind == IN_INSN && is_load_rax(i1) && is_insn(i2, "mov") &&
+        !strcmp(i2->ops[0], "%rax") && is_reg(i2->ops[1]) &&
+        !strstr(i2->ops[1], "%e") && kills_rax(i3)) {
+        i1->ops[1] = i2->ops[1];
+        i1->next = i3;
+        return true;
+    }
+
+    // setX %al; movzb %al, %rax; cmp $0, %rax; je L => jnX L
+    //
+    // This sequence only comes from testing a condition, after which %rax
+    // is dead on both paths.
+    if (i1->kind == IN_INSN && negate_set(i1->op) && is_insn(i2, "movzb") &&
+        is_insn(i3, "cmp") && !strcmp(i3->ops[0], "$0") &&
+        !strcmp(i3->ops[1], "%rax") && is_insn(i4, "je")) {
+        replace(i1, negate_set(i1->op), 1, i4->ops[0], NULL);
+        i1->next = i4->next;
+        return true;
+    }
+
+    // jmp L; L: => L:
+    if (is_insn(i1, "jmp")) {
+        for (Insn *insn = i2; insn && insn->kind == IN_LABEL; insn = insn->next) {
+            if (!strcmp(insn->op, i1->ops[0])) {
+                *p = i2;
+                return true;
+            }
+        }
+    }
+
+    // Instructions between an unconditional jump and the next label are
+    // never executed.
+    if ((is_insn(i1, "jmp") || is_insn(i1, "ret")) && i2 && i2->kind == IN_INSN) {
+        i1->next = i3;
+        return true;
+    }
+
+    return false;
+}
+
+void Peephole(Insn **insns) {
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (Insn **p = insns; *p;) {
+            if (rewrite(p))
+                changed = true;
+            else
+                p = &(*p)->next;
+        }
+    }
+}
@@ -2,6 +2,9 @@
 #include <stdbool.h>
 #include <string.h>
 #include <ctype.h>
+#ifdef __x86_64__
+#include <immintrin.h>
+#endif
 
 #include "5cc.h"
 
@@ -14,59 +17,271 @@ static bool is_alnum(char c) {
     return is_al(c) || ('0' <= c && c <= '9');
 }
 
-static bool IsStrReserved(char *A, char *reserved) {
-    return IsStrSame(A, reserved) && !is_alnum(A[strlen(reserved)]);
+//===================================================================
+// Scanning
+//===================================================================
+// Runs of whitespace and identifier characters and the insides of
+// comments and string literals are skipped 16 bytes at a time with SSE2,
+// or 32 with AVX2 if the CPU has it. A kernel builds a mask of the bytes
+// that end the run and jumps to the first one. The bytes too close to the
+// end of the input for a full load are looked at one by one.
+typedef enum {
+    SCAN_SPACE,   // up to a byte that is not whitespace
+    SCAN_IDENT,   // up to a byte that cannot be in an identifier
+    SCAN_LINE,    // up to a newline
+    SCAN_STAR,    // up to a '*'
+    SCAN_STRING,  // up to a '"', a '\\' or a newline
+} ScanKind;
+
+static char *input_end;
+static bool has_avx2;
+
+static bool is_stop(char c, ScanKind kind) {
+    switch (kind) {
+    case SCAN_SPACE: return !isspace(c);
+    case SCAN_IDENT: return !is_alnum(c);
+    case SCAN_LINE: return c == '\n';
+    case SCAN_STAR: return c == '*';
+    case SCAN_STRING: return c == '"' || c == '\\' || c == '\n';
+    }
+    return true;
+}
+
+static char *scan_scalar(char *p, ScanKind kind) {
+    while (p < input_end && !is_stop(*p, kind))
+        p++;
+    return p;
+}
+
+#ifdef __x86_64__
+// Marks the bytes of v in [lo, hi]. Subtracting lo wraps the others above
+// hi - lo, so an unsigned comparison is enough.
+static __m128i in_range16(__m128i v, char lo, char hi) {
+    __m128i d = _mm_sub_epi8(v, _mm_set1_epi8(lo));
+    return _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(hi - lo)), d);
+}
+
+static unsigned stop_mask16(__m128i v, ScanKind kind) {
+    __m128i m;
+    switch (kind) {
+    case SCAN_SPACE:
+        m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(' ')), in_range16(v, '\t', '\r'));
+        return ~_mm_movemask_epi8(m) & 0xffff;
+    case SCAN_IDENT:
+        // Setting bit 5 folds upper case letters into lower case ones.
+        m = in_range16(_mm_or_si128(v, _mm_set1_epi8(0x20)), 'a', 'z');
+        m = _mm_or_si128(m, in_range16(v, '0', '9'));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('_')));
+        return ~_mm_movemask_epi8(m) & 0xffff;
+    case SCAN_LINE:
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+    case SCAN_STAR:
+        return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('*')));
+    case SCAN_STRING:
+        m = _mm_cmpeq_epi8(v, _mm_set1_epi8('"'));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\\')));
+        m = _mm_or_si128(m, _mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+        return _mm_movemask_epi8(m);
+    }
+    return 1;
+}
+
+static char *scan_sse2(char *p, ScanKind kind) {
+    for (; p + 16 <= input_end; p += 16) {
+        unsigned mask = stop_mask16(_mm_loadu_si128((__m128i *)p), kind);
+        if (mask)
+            return p + __builtin_ctz(mask);
+    }
+    return scan_scalar(p, kind);
+}
+
+__attribute__((target("avx2")))
+static __m256i in_range32(__m256i v, char lo, char hi) {
+    __m256i d = _mm256_sub_epi8(v, _mm256_set1_epi8(lo));
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(hi - lo)), d);
 }
 
+__attribute__((target("avx2")))
+static unsigned stop_mask32(__m256i v, ScanKind kind) {
+    __m256i m;
+    switch (kind) {
+    case SCAN_SPACE:
+        m = _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(' ')),
+                            in_range32(v, '\t', '\r'));
+        return ~_mm256_movemask_epi8(m);
+    case SCAN_IDENT:
+        m = in_range32(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), 'a', 'z');
+        m = _mm256_or_si256(m, in_range32(v, '0', '9'));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_')));
+        return ~_mm256_movemask_epi8(m);
+    case SCAN_LINE:
+        return _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')));
+    case SCAN_STAR:
+        return _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('*')));
+    case SCAN_STRING:
+        m = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('"'));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\')));
+        m = _mm256_or_si256(m, _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n')));
+        return _mm256_movemask_epi8(m);
+    }
+    return 1;
+}
+
+__attribute__((target("avx2")))
+static char *scan_avx2(char *p, ScanKind kind) {
+    for (; p + 32 <= input_end; p += 32) {
+        unsigned mask = stop_mask32(_mm256_loadu_si256((__m256i *)p), kind);
+        if (mask)
+            return p + __builtin_ctz(mask);
+    }
+    return scan_sse2(p, kind);
+}
+#endif
+
+// Returns the first byte from p on that ends a run of the given kind, or
+// the end of the input.
+static char *scan(char *p, ScanKind kind) {
+#ifdef __x86_64__
+    if (has_avx2)
+        return scan_avx2(p, kind);
+    return scan_sse2(p, kind);
+#else
+    return scan_scalar(p, kind);
+#endif
+}
+
+static Token *tokens;
+static int num_tokens;
+static int cap_tokens;
+
+typedef union {
+    int64_t val;
+    char *str;
+} Literal;
+
+static Literal *literals;
+static int num_literals;
+static int cap_literals;
+
+// The returned token stays in place until the next one is added.
 static Token *NewToken(TokenKind TK, char *start, char *end) {
-    Token *new = calloc(1, sizeof(Token));
+    if (num_tokens == cap_tokens) {
+        cap_tokens = cap_tokens ? cap_tokens * 2 : 1024;
+        tokens = realloc(tokens, sizeof(Token) * cap_tokens);
+        if (!tokens)
+            Error("out of memory");
+    }
+    Token *new = &tokens[num_tokens++];
     new->kind = TK;
-    new->loc = start;
+    new->offset = start - UserInput;
     new->len = end - start;
+    new->lit = -1;
     return new;
 }
 
-static Token *NewTokenReserved(char **start) {
-    Token *new = NULL;
-    static struct {
-        char *word;
-        int len;
-    } symbol[] = {
-        {"<=", 2}, {">=", 2}, {"==", 2}, {"!=", 2}, {"->", 2}, 
-        {"-", 1}, {"+", 1}, {"/", 1}, {"*", 1}, {"%", 1},
-        {"<", 1}, {">", 1}, {"(", 1}, {")", 1},
-        {";", 1}, {"=", 1}, {"{", 1}, {"}", 1},
-        {"&", 1}, {",", 1}, {"[", 1}, {"]", 1},
-        {".", 1},
-        {NULL, 0},
-    };
-
-    static struct {
-        char *word;
-        int len;
-    } keyword[] = {
-        {"return", 6}, {"while", 5}, {"else", 4}, {"for", 3},
-        {"sizeof", 6}, {"short", 5}, {"char", 4}, {"int", 3},
-        {"struct", 6}, {"union", 5}, {"long", 4}, {"if", 2},
-        {"typedef", 7}, {"void", 4},
-        {NULL, 0},
-    };
-
-    for (int i = 0; symbol[i].word; i++) {
-        if (IsStrSame(*start, symbol[i].word)) {
-            new = NewToken(TK_RESERVED, *start, *start + symbol[i].len);
-            *start = *start + symbol[i].len;
-            return new;
-        }
+static Literal *NewLiteral(Token *tok) {
+    if (num_literals == cap_literals) {
+        cap_literals = cap_literals ? cap_literals * 2 : 256;
+        literals = realloc(literals, sizeof(Literal) * cap_literals);
+        if (!literals)
+            Error("out of memory");
     }
-    for (int i = 0; keyword[i].word; i++) {
-        if (IsStrReserved(*start, keyword[i].word)) {
-            new = NewToken(TK_RESERVED, *start, *start + keyword[i].len);
-            *start = *start + keyword[i].len;
-            return new;
+    tok->lit = num_literals;
+    return &literals[num_literals++];
+}
+
+char *TokenLoc(Token *tok) {
+    return UserInput + tok->offset;
+}
+
+int64_t TokenVal(Token *tok) {
+    return literals[tok->lit].val;
+}
+
+char *TokenStr(Token *tok) {
+    return literals[tok->lit].str;
+}
+
+static char *spelling[] = {
+    [TK_NUM] = "number", [TK_IDENT] = "identifier", [TK_STR] = "string",
+    [TK_EOF] = "end of file",
+    [TK_LE] = "<=", [TK_GE] = ">=", [TK_EQ] = "==", [TK_NE] = "!=", [TK_ARROW] = "->",
+    [TK_MINUS] = "-", [TK_PLUS] = "+", [TK_SLASH] = "/", [TK_STAR] = "*",
+    [TK_PERCENT] = "%", [TK_LT] = "<", [TK_GT] = ">", [TK_LPAREN] = "(",
+    [TK_RPAREN] = ")", [TK_SEMICOLON] = ";", [TK_ASSIGN] = "=", [TK_LBRACE] = "{",
+    [TK_RBRACE] = "}", [TK_AMP] = "&", [TK_COMMA] = ",", [TK_LBRACKET] = "[",
+    [TK_RBRACKET] = "]", [TK_DOT] = ".",
+    [TK_RETURN] = "return", [TK_WHILE] = "while", [TK_ELSE] = "else", [TK_FOR] = "for",
+    [TK_SIZEOF] = "sizeof", [TK_SHORT] = "short", [TK_CHAR] = "char", [TK_INT] = "int",
+    [TK_STRUCT] = "struct", [TK_UNION] = "union", [TK_LONG] = "long", [TK_IF] = "if",
+    [TK_TYPEDEF] = "typedef", [TK_VOID] = "void",
+};
+
+char *TokenSpelling(TokenKind kind) {
+    return spelling[kind];
+}
+
+// Kinds of the one-byte punctuators, by that byte. TK_NUM marks bytes
+// that start none.
+static TokenKind punct[128] = {
+    ['-'] = TK_MINUS, ['+'] = TK_PLUS, ['/'] = TK_SLASH, ['*'] = TK_STAR,
+    ['%'] = TK_PERCENT, ['<'] = TK_LT, ['>'] = TK_GT, ['('] = TK_LPAREN,
+    [')'] = TK_RPAREN, [';'] = TK_SEMICOLON, ['='] = TK_ASSIGN, ['{'] = TK_LBRACE,
+    ['}'] = TK_RBRACE, ['&'] = TK_AMP, [','] = TK_COMMA, ['['] = TK_LBRACKET,
+    [']'] = TK_RBRACKET, ['.'] = TK_DOT,
+};
+
+// Returns the length of the punctuator at p and sets its kind, or returns
+// 0. Only a few first bytes can start a two-byte punctuator.
+static int ReadPunct(char *p, TokenKind *kind) {
+    if (p[1] == '=') {
+        switch (*p) {
+        case '<': *kind = TK_LE; return 2;
+        case '>': *kind = TK_GE; return 2;
+        case '=': *kind = TK_EQ; return 2;
+        case '!': *kind = TK_NE; return 2;
         }
     }
-    return new;
+    if (p[0] == '-' && p[1] == '>') {
+        *kind = TK_ARROW;
+        return 2;
+    }
+    *kind = (unsigned char)*p < 128 ? punct[(unsigned char)*p] : TK_NUM;
+    return *kind != TK_NUM;
+}
+
+// A perfect hash of the keywords, checked once an identifier-like word has
+// been scanned. Each keyword is a case of the switch in WordKind(), so two
+// keywords sharing a slot are a duplicate case, which any C compiler
+// rejects.
+#define KEYWORD_HASH(first, last, len) (((first) + (last) * 5 + (len)) & 31)
+
+#define KEYWORDS(X)            \
+    X('r', 'n', 6, TK_RETURN)  \
+    X('w', 'e', 5, TK_WHILE)   \
+    X('e', 'e', 4, TK_ELSE)    \
+    X('f', 'r', 3, TK_FOR)     \
+    X('s', 'f', 6, TK_SIZEOF)  \
+    X('s', 't', 5, TK_SHORT)   \
+    X('c', 'r', 4, TK_CHAR)    \
+    X('i', 't', 3, TK_INT)     \
+    X('s', 't', 6, TK_STRUCT)  \
+    X('u', 'n', 5, TK_UNION)   \
+    X('l', 'g', 4, TK_LONG)    \
+    X('i', 'f', 2, TK_IF)      \
+    X('t', 'f', 7, TK_TYPEDEF) \
+    X('v', 'd', 4, TK_VOID)
+
+#define KEYWORD_CASE(first, last, len, kind) \
+    case KEYWORD_HASH(first, last, len):     \
+        return len == n && !memcmp(start, spelling[kind], len) ? kind : TK_IDENT;
+
+// Returns the kind of the keyword or TK_IDENT.
+static TokenKind WordKind(char *start, int n) {
+    switch (KEYWORD_HASH(start[0], start[n - 1], n)) {
+    KEYWORDS(KEYWORD_CASE)
+    }
+    return TK_IDENT;
 }
 
 static char ReadEscapedLiteral(char *p) {
@@ -85,18 +300,20 @@ static char ReadEscapedLiteral(char *p) {
 
 static char *EndOfStrLiteral(char *p) {
     char *start = p;
-    for (; *p != '\"'; p++) {
-        if (*p == '\n' || *p == '\0') {
+    for (;;) {
+        p = scan(p, SCAN_STRING);
+        if (*p == '\"')
+            return p;
+        // A newline or the end of the input, or a backslash right before it
+        if (*p != '\\' || p + 1 == input_end)
             ErrorAt(start, "unclosed string literal");
-        }
-        if (*p == '\\') p++;
+        p += 2;
     }
-    return p;
 }
 
 static Token *ReadStrLiteral(char **start) {
     char *end = EndOfStrLiteral(*start + 1);
-    char *string = calloc(end - *start, sizeof(char));
+    char *string = Alloc(end - *start);
     int len  = 0;
 
     for (char *p = *start + 1; p < end; p++) {
@@ -108,64 +325,77 @@ static Token *ReadStrLiteral(char **start) {
         }
     }
     Token *tok = NewToken(TK_STR, *start, end + 1);
-    tok->string = string;
+    NewLiteral(tok)->str = string;
     *start = end + 1;
     return tok;
 }
 
+// p must point into UserInput, against which token offsets are taken.
 Token *Tokenize(char *p) {
-    Token head;
-    head.next = NULL;
-    Token *cur = &head;
+    num_tokens = 0;
+    input_end = p + strlen(p);
+#ifdef __x86_64__
+    has_avx2 = __builtin_cpu_supports("avx2");
+#endif
 
     while (*p) {
         if (isspace(*p)) {
-            p++;
+            p = scan(p, SCAN_SPACE);
             continue;
         }
         
         if (isdigit(*p)) {
-            cur = cur->next = NewToken(TK_NUM, p, p);
+            Token *tok = NewToken(TK_NUM, p, p);
             char *q = p;
-            cur->val = strtol(p, &p, 10);
-            cur->len = p - q;
+            NewLiteral(tok)->val = strtol(p, &p, 10);
+            tok->len = p - q;
             continue;
         }
 
         if (IsStrSame(p, "//")) {
-            p += 2;
-            while (*p != '\n') p++;
+            p = scan(p + 2, SCAN_LINE);
             continue;
         }
         
         if (IsStrSame(p, "/*")) {
-            char *q = strstr(p + 2, "*/");
-            if (!q) ErrorAt(p, "unclosed comment");
+            char *q = p + 2;
+            for (;; q++) {
+                q = scan(q, SCAN_STAR);
+                if (q == input_end)
+                    ErrorAt(p, "unclosed comment");
+                if (q[1] == '/')
+                    break;
+            }
             p = q + 2;
             continue;
         }
 
-        Token *tok = NewTokenReserved(&p);
-        if (tok) {
-            cur = cur->next = tok;
+        TokenKind kind;
+        int len = ReadPunct(p, &kind);
+        if (len) {
+            NewToken(kind, p, p + len);
+            p += len;
             continue;
         }
 
         if (*p == '"') {
-            cur = cur->next = ReadStrLiteral(&p);
+            ReadStrLiteral(&p);
             continue;
         }
 
         if (is_al(*p)) {
             char *start = p;
-            for (; is_alnum(*p);) p++;  // len(ident_name)
-            cur = cur->next = NewToken(TK_IDENT, start, p);
+            p = scan(p, SCAN_IDENT);
+            TokenKind kind = WordKind(start, p - start);
+            Token *tok = NewToken(kind, start, p);
+            if (kind == TK_IDENT)
+                tok->lit = InternIdent(start, p - start);
             continue;
         }
 
          ErrorAt(p, "Can't tokenize!");
     }
 
-    cur = cur->next = NewToken(TK_EOF, p, p);
-    return head.next;
+    NewToken(TK_EOF, p, p);
+    return tokens;
 }
\ No newline at end of file
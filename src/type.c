@@ -11,7 +11,7 @@ Type *ty_short = &(Type){.kind = TY_SHORT, .size = 2, .align = 2};
 Type *ty_void = &(Type){.kind = TY_VOID, .size = 1, .align = 1};
 
 Type *NewType(TypeKind kind, int size, int align) {
-    Type *new = calloc(1, sizeof(Type));
+    Type *new = Alloc(sizeof(Type));
     new->kind = kind;
     new->size = size;
     new->align = align;
@@ -25,7 +25,7 @@ Type *NewTypePTR2(Type *base) {
 }
 
 Type *NewTypeFn(Type *return_type) {
-    Type *new = calloc(1, sizeof(Type));
+    Type *new = Alloc(sizeof(Type));
     new->kind = TY_FN;
     new->return_type = return_type;
     return new;
@@ -43,7 +43,7 @@ bool IsTypeInteger(Type *ty) {
 }
 
 Type *CopyType(Type *ty) {
-    Type *ret = calloc(1, sizeof(Type));
+    Type *ret = Alloc(sizeof(Type));
     *ret = *ty;
     return ret;
 }
@@ -73,6 +73,7 @@ void AddType(Node *node) {
     case ND_NEG:
     case ND_MOD:
     case ND_AND:
+    case ND_SHL:
         node->type = node->lhs->type;
         return;
     case ND_COMMA:
@@ -88,9 +89,11 @@ void AddType(Node *node) {
     case ND_LT:
     case ND_LE:
     case ND_NUM:
-    case ND_FNCALL:
         node->type = ty_long;
         return;
+    case ND_FNCALL:
+        node->type = node->func_type ? node->func_type->return_type : ty_long;
+        return;
     case ND_DOTS:
         node->type = node->member->type;
         return;
@@ -10,6 +10,153 @@ bool IsStrSame(char *A, char *B) {
     return (strncmp(A, B, strlen(B)) == 0);
 }
 
+//===================================================================
+// Arena allocator
+//===================================================================
+// Memory is handed out by bumping a pointer through large chunks and is
+// only released a whole arena at a time. Tokens, types and globals live as
+// long as the compilation; the AST, locals, IR and instructions of a
+// function come from its own arena, which is freed once it is emitted.
+#define CHUNK_SIZE (256 * 1024)
+
+typedef struct Chunk Chunk;
+struct Chunk {
+    Chunk *next;
+    char *ptr;
+    char *end;
+};
+
+struct Arena {
+    Chunk *chunks;
+};
+
+static Arena permanent;
+Arena *FnArena;
+
+static void *arena_alloc(Arena *arena, size_t size) {
+    size = (size + 15) & ~(size_t)15;
+    Chunk *chunk = arena->chunks;
+    if (!chunk || (size_t)(chunk->end - chunk->ptr) < size) {
+        size_t cap = size > CHUNK_SIZE ? size : CHUNK_SIZE;
+        // calloc gets chunks this large straight from mmap, already zeroed.
+        chunk = calloc(1, sizeof(Chunk) + cap);
+        if (!chunk)
+            Error("out of memory");
+        chunk->ptr = (char *)(chunk + 1);
+        chunk->end = chunk->ptr + cap;
+        chunk->next = arena->chunks;
+        arena->chunks = chunk;
+    }
+    void *ptr = chunk->ptr;
+    chunk->ptr += size;
+    return ptr;
+}
+
+Arena *NewArena(void) {
+    return Alloc(sizeof(Arena));
+}
+
+void FreeArena(Arena *arena) {
+    while (arena->chunks) {
+        Chunk *next = arena->chunks->next;
+        free(arena->chunks);
+        arena->chunks = next;
+    }
+}
+
+// Returns zeroed memory that is never freed.
+void *Alloc(size_t size) {
+    return arena_alloc(&permanent, size);
+}
+
+// Returns zeroed memory that is freed along with the current function.
+void *FnAlloc(size_t size) {
+    return arena_alloc(FnArena ? FnArena : &permanent, size);
+}
+
+char *StrNDup(char *s, size_t len) {
+    char *ret = Alloc(len + 1);
+    memcpy(ret, s, len);
+    return ret;
+}
+
+//===================================================================
+// Identifiers
+//===================================================================
+// Every identifier is interned once by the tokenizer, so equal names are
+// the same pointer and are compared as such. An identifier is known by
+// its index in idents, which also keeps its hash for the parser's scopes.
+typedef struct {
+    char *name;
+    unsigned hash;
+} Ident;
+
+static Ident *idents;
+static int num_idents;
+static int cap_idents;
+
+// Open addressing table of identifier IDs plus one, 0 being empty.
+static int *ident_table;
+static int ident_table_size;
+
+static unsigned HashName(char *name, int len) {
+    unsigned h = 2166136261u;
+    for (int i = 0; i < len; i++)
+        h = (h ^ (unsigned char)name[i]) * 16777619u;
+    return h;
+}
+
+static void insert_ident(int id) {
+    int mask = ident_table_size - 1;
+    int i = idents[id].hash & mask;
+    while (ident_table[i])
+        i = (i + 1) & mask;
+    ident_table[i] = id + 1;
+}
+
+static void grow_ident_table(void) {
+    free(ident_table);
+    ident_table_size = ident_table_size ? ident_table_size * 2 : 4096;
+    ident_table = calloc(ident_table_size, sizeof(int));
+    if (!ident_table)
+        Error("out of memory");
+    for (int id = 0; id < num_idents; id++)
+        insert_ident(id);
+}
+
+int InternIdent(char *name, int len) {
+    if (num_idents * 2 >= ident_table_size)
+        grow_ident_table();
+
+    unsigned hash = HashName(name, len);
+    int mask = ident_table_size - 1;
+    for (int i = hash & mask; ident_table[i]; i = (i + 1) & mask) {
+        Ident *ident = &idents[ident_table[i] - 1];
+        if (ident->hash == hash && !strncmp(ident->name, name, len) && !ident->name[len])
+            return ident_table[i] - 1;
+    }
+
+    if (num_idents == cap_idents) {
+        cap_idents = cap_idents ? cap_idents * 2 : 1024;
+        idents = realloc(idents, sizeof(Ident) * cap_idents);
+        if (!idents)
+            Error("out of memory");
+    }
+    int id = num_idents++;
+    idents[id].name = StrNDup(name, len);
+    idents[id].hash = hash;
+    insert_ident(id);
+    return id;
+}
+
+char *IdentName(int id) {
+    return idents[id].name;
+}
+
+unsigned IdentHash(int id) {
+    return idents[id].hash;
+}
+
 //===================================================================
 // Error
 //===================================================================
@@ -57,7 +204,7 @@ void ErrorAt(char *loc, char *fmt, ...) {
 void ErrorToken(Token *tok, char *fmt, ...) {
     va_list ap;
     va_start(ap, fmt);
-    verror_at(InputPath, UserInput, tok->loc, fmt, ap);
+    verror_at(InputPath, UserInput, TokenLoc(tok), fmt, ap);
     exit(1);
 }
 
@@ -74,24 +221,24 @@ void Debug(char *fmt, ...) {
 }
 
 void PrintToken(Token *tok) {
-    for (Token *t = tok; t; t = t->next) {
+    for (Token *t = tok;; t++) {
         switch (t->kind) {
         case TK_NUM:
             Debug("Number");
             continue;
-        case TK_RESERVED:
-            Debug("Reserved");
-            continue;
         case TK_IDENT:
             Debug("Ident");
             continue;
         case TK_STR:
             Debug("String");
-            Debug("-: %s", t->string);
+            Debug("-: %s", TokenStr(t));
             continue;
         case TK_EOF:
             Debug("End Of File");
             return;
+        default:
+            Debug("Reserved");
+            continue;
         }
     }
 }
@@ -106,6 +253,9 @@ void PrintNode(Node *node) {
         DEBUG_NODE(ND_DIV);
         DEBUG_NODE(ND_NEG);
         DEBUG_NODE(ND_NUM);
+        DEBUG_NODE(ND_AND);
+        DEBUG_NODE(ND_MOD);
+        DEBUG_NODE(ND_SHL);
         DEBUG_NODE(ND_EQ); // ==
         DEBUG_NODE(ND_NE); // !=
         DEBUG_NODE(ND_LT); // <
@@ -139,4 +289,78 @@ void PrintObjFn(Obj *obj) {
         Debug("FUNCTION");
         PrintNode(fn->body);
      }
-}
\ No newline at end of file
+}
+static char *ir_op_name[] = {
+    [IR_IMM] = "imm",   [IR_PARAM] = "param", [IR_ADDR] = "addr",
+    [IR_LOAD] = "load", [IR_STORE] = "store", [IR_EXT] = "ext",
+    [IR_NEG] = "neg",   [IR_ADD] = "add",     [IR_SUB] = "sub",
+    [IR_MUL] = "mul",   [IR_DIV] = "div",     [IR_MOD] = "mod",
+    [IR_AND] = "and",   [IR_SHL] = "shl",     [IR_EQ] = "eq",
+    [IR_NE] = "ne",     [IR_LT] = "lt",       [IR_LE] = "le",
+    [IR_CALL] = "call", [IR_PHI] = "phi",     [IR_JMP] = "jmp",
+    [IR_BR] = "br",     [IR_RET] = "ret",
+};
+
+static void print_ir_insn(IrInsn *insn) {
+    char *line;
+    size_t len;
+    FILE *out = open_memstream(&line, &len);
+
+    if (insn->id)
+        fprintf(out, "v%d = ", insn->id);
+    fprintf(out, "%s", ir_op_name[insn->op]);
+    if (insn->type)
+        fprintf(out, ".%d", insn->type->size);
+    else if (insn->op >= IR_ADD && insn->op <= IR_LE)
+        fprintf(out, ".%d", insn->wide ? 64 : 32);
+
+    switch (insn->op) {
+    case IR_IMM:
+    case IR_PARAM:
+        fprintf(out, " %ld", insn->val);
+        break;
+    case IR_ADDR:
+        fprintf(out, " %s", insn->var->name);
+        break;
+    case IR_CALL:
+        fprintf(out, " %s", insn->fn_name);
+        break;
+    case IR_PHI:
+        for (int i = 0; i < insn->nargs; i++)
+            fprintf(out, "%s[v%d, bb%d]", i ? ", " : " ", insn->args[i]->id,
+                    insn->block->preds[i]->id);
+        fprintf(out, "  ; %s", insn->var->name);
+        break;
+    }
+    if (insn->op != IR_PHI)
+        for (int i = 0; i < insn->nargs; i++)
+            fprintf(out, "%s v%d", i ? "," : "", insn->args[i]->id);
+    if (insn->then)
+        fprintf(out, "%s bb%d", insn->nargs ? "," : "", insn->then->id);
+    if (insn->els)
+        fprintf(out, ", bb%d", insn->els->id);
+
+    fclose(out);
+    Debug("    %s", line);
+    free(line);
+}
+
+void PrintIR(IrFunc *ir) {
+    Debug("FUNCTION %s", ir->fn->name);
+    for (IrBlock *block = ir->blocks; block; block = block->next) {
+        if (block->npreds) {
+            char *line;
+            size_t len;
+            FILE *out = open_memstream(&line, &len);
+            for (int i = 0; i < block->npreds; i++)
+                fprintf(out, "%sbb%d", i ? ", " : "", block->preds[i]->id);
+            fclose(out);
+            Debug("bb%d:  ; preds %s", block->id, line);
+            free(line);
+        } else {
+            Debug("bb%d:", block->id);
+        }
+        for (IrInsn *insn = block->insns; insn; insn = insn->next)
+            print_ir_insn(insn);
+    }
+}
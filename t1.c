@@ -0,0 +1,10 @@
+int printf();
+long f(int a) { return a - 5; }
+int g(int a, int b) { return a + b; }
+int main() {
+  int y; y = 2;
+  printf("%ld\n", f(y));
+  int x; x = 1;
+  printf("%d\n", g(x, 3));
+  return 0;
+}
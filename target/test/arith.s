@@ -0,0 +1,967 @@
+.data
+	.global .L.L.42
+.L.L.42:
+	.byte 79
+	.byte 75
+	.byte 10
+	.byte 0
+.data
+	.global .L.L.41
+.L.L.41:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 45
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.40
+.L.L.40:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 51
+	.byte 60
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.39
+.L.L.39:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 50
+	.byte 60
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.38
+.L.L.38:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 53
+	.byte 60
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.37
+.L.L.37:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 43
+	.byte 50
+	.byte 43
+	.byte 51
+	.byte 43
+	.byte 52
+	.byte 43
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.36
+.L.L.36:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 42
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.35
+.L.L.35:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 42
+	.byte 49
+	.byte 43
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.34
+.L.L.34:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 45
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 52
+	.byte 42
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.33
+.L.L.33:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 45
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 42
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.32
+.L.L.32:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 45
+	.byte 57
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 37
+	.byte 56
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.31
+.L.L.31:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 45
+	.byte 57
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 47
+	.byte 56
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.30
+.L.L.30:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 37
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.29
+.L.L.29:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 45
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 37
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.28
+.L.L.28:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 45
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 47
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.27
+.L.L.27:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 54
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 38
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.26
+.L.L.26:
+	.byte 53
+	.byte 38
+	.byte 51
+	.byte 0
+.data
+	.global .L.L.25
+.L.L.25:
+	.byte 49
+	.byte 62
+	.byte 61
+	.byte 50
+	.byte 0
+.data
+	.global .L.L.24
+.L.L.24:
+	.byte 49
+	.byte 62
+	.byte 61
+	.byte 49
+	.byte 0
+.data
+	.global .L.L.23
+.L.L.23:
+	.byte 49
+	.byte 62
+	.byte 61
+	.byte 48
+	.byte 0
+.data
+	.global .L.L.22
+.L.L.22:
+	.byte 49
+	.byte 62
+	.byte 50
+	.byte 0
+.data
+	.global .L.L.21
+.L.L.21:
+	.byte 49
+	.byte 62
+	.byte 49
+	.byte 0
+.data
+	.global .L.L.20
+.L.L.20:
+	.byte 49
+	.byte 62
+	.byte 48
+	.byte 0
+.data
+	.global .L.L.19
+.L.L.19:
+	.byte 50
+	.byte 60
+	.byte 61
+	.byte 49
+	.byte 0
+.data
+	.global .L.L.18
+.L.L.18:
+	.byte 49
+	.byte 60
+	.byte 61
+	.byte 49
+	.byte 0
+.data
+	.global .L.L.17
+.L.L.17:
+	.byte 48
+	.byte 60
+	.byte 61
+	.byte 49
+	.byte 0
+.data
+	.global .L.L.16
+.L.L.16:
+	.byte 50
+	.byte 60
+	.byte 49
+	.byte 0
+.data
+	.global .L.L.15
+.L.L.15:
+	.byte 49
+	.byte 60
+	.byte 49
+	.byte 0
+.data
+	.global .L.L.14
+.L.L.14:
+	.byte 48
+	.byte 60
+	.byte 49
+	.byte 0
+.data
+	.global .L.L.13
+.L.L.13:
+	.byte 52
+	.byte 50
+	.byte 33
+	.byte 61
+	.byte 52
+	.byte 50
+	.byte 0
+.data
+	.global .L.L.12
+.L.L.12:
+	.byte 48
+	.byte 33
+	.byte 61
+	.byte 49
+	.byte 0
+.data
+	.global .L.L.11
+.L.L.11:
+	.byte 52
+	.byte 50
+	.byte 61
+	.byte 61
+	.byte 52
+	.byte 50
+	.byte 0
+.data
+	.global .L.L.10
+.L.L.10:
+	.byte 48
+	.byte 61
+	.byte 61
+	.byte 49
+	.byte 0
+.data
+	.global .L.L.9
+.L.L.9:
+	.byte 45
+	.byte 32
+	.byte 45
+	.byte 32
+	.byte 43
+	.byte 49
+	.byte 48
+	.byte 0
+.data
+	.global .L.L.8
+.L.L.8:
+	.byte 45
+	.byte 32
+	.byte 45
+	.byte 49
+	.byte 48
+	.byte 0
+.data
+	.global .L.L.7
+.L.L.7:
+	.byte 45
+	.byte 49
+	.byte 48
+	.byte 43
+	.byte 50
+	.byte 48
+	.byte 0
+.data
+	.global .L.L.6
+.L.L.6:
+	.byte 40
+	.byte 51
+	.byte 43
+	.byte 53
+	.byte 41
+	.byte 47
+	.byte 50
+	.byte 0
+.data
+	.global .L.L.5
+.L.L.5:
+	.byte 53
+	.byte 42
+	.byte 40
+	.byte 57
+	.byte 45
+	.byte 54
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.4
+.L.L.4:
+	.byte 53
+	.byte 43
+	.byte 54
+	.byte 42
+	.byte 55
+	.byte 0
+.data
+	.global .L.L.3
+.L.L.3:
+	.byte 49
+	.byte 50
+	.byte 32
+	.byte 43
+	.byte 32
+	.byte 51
+	.byte 52
+	.byte 32
+	.byte 45
+	.byte 32
+	.byte 53
+	.byte 0
+.data
+	.global .L.L.2
+.L.L.2:
+	.byte 53
+	.byte 43
+	.byte 50
+	.byte 48
+	.byte 45
+	.byte 52
+	.byte 0
+.data
+	.global .L.L.1
+.L.L.1:
+	.byte 52
+	.byte 50
+	.byte 0
+.data
+	.global .L.L.0
+.L.L.0:
+	.byte 48
+	.byte 0
+.text
+	.globl main
+main:
+	push %rbp
+	mov %rsp, %rbp
+	sub $96, %rsp
+	mov %r13, -72(%rbp)
+	mov %r14, -80(%rbp)
+	mov %r15, -88(%rbp)
+.L.body.main:
+	mov $0, %rsi
+	lea .L.L.0(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $42, %rsi
+	lea .L.L.1(%rip), %rax
+	mov %rax, %rdx
+	mov $42, %rdi
+	mov $0, %rax
+	call assert_
+	mov $21, %rsi
+	lea .L.L.2(%rip), %rax
+	mov %rax, %rdx
+	mov $21, %rdi
+	mov $0, %rax
+	call assert_
+	mov $41, %rsi
+	lea .L.L.3(%rip), %rax
+	mov %rax, %rdx
+	mov $41, %rdi
+	mov $0, %rax
+	call assert_
+	mov $47, %rsi
+	lea .L.L.4(%rip), %rax
+	mov %rax, %rdx
+	mov $47, %rdi
+	mov $0, %rax
+	call assert_
+	mov $15, %rsi
+	lea .L.L.5(%rip), %rax
+	mov %rax, %rdx
+	mov $15, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.6(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $10, %rsi
+	lea .L.L.7(%rip), %rax
+	mov %rax, %rdx
+	mov $10, %rdi
+	mov $0, %rax
+	call assert_
+	mov $10, %rsi
+	lea .L.L.8(%rip), %rax
+	mov %rax, %rdx
+	mov $10, %rdi
+	mov $0, %rax
+	call assert_
+	mov $10, %rsi
+	lea .L.L.9(%rip), %rax
+	mov %rax, %rdx
+	mov $10, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rsi
+	lea .L.L.10(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.11(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.12(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rsi
+	lea .L.L.13(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.14(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rsi
+	lea .L.L.15(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rsi
+	lea .L.L.16(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.17(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.18(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rsi
+	lea .L.L.19(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.20(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rsi
+	lea .L.L.21(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rsi
+	lea .L.L.22(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.23(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.24(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rsi
+	lea .L.L.25(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.26(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $6, %rax
+	mov %eax, -56(%rbp)
+	movsxd -56(%rbp), %rax
+	and $3, %eax
+	mov %rax, %rsi
+	lea .L.L.27(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $-7, %rax
+	mov %eax, -52(%rbp)
+	movsxd -52(%rbp), %rax
+	mov %eax, %edi
+	sar $31, %edi
+	shr $31, %edi
+	add %edi, %eax
+	sar $1, %eax
+	mov %rax, %rsi
+	lea .L.L.28(%rip), %rax
+	mov %rax, %rdx
+	mov $-3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $-7, %rax
+	mov %eax, -48(%rbp)
+	movsxd -48(%rbp), %rax
+	mov %eax, %edi
+	sar $31, %edi
+	shr $30, %edi
+	add %edi, %eax
+	and $3, %eax
+	sub %edi, %eax
+	mov %rax, %rsi
+	lea .L.L.29(%rip), %rax
+	mov %rax, %rdx
+	mov $-3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $7, %rax
+	mov %eax, -44(%rbp)
+	movsxd -44(%rbp), %rax
+	mov %eax, %edi
+	sar $31, %edi
+	shr $30, %edi
+	add %edi, %eax
+	and $3, %eax
+	sub %edi, %eax
+	mov %rax, %rsi
+	lea .L.L.30(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $-9, %rax
+	mov %rax, -40(%rbp)
+	mov -40(%rbp), %rax
+	mov %rax, %rdi
+	sar $63, %rdi
+	shr $61, %rdi
+	add %rdi, %rax
+	sar $3, %rax
+	mov %rax, %rsi
+	lea .L.L.31(%rip), %rax
+	mov %rax, %rdx
+	mov $-1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $-9, %rax
+	mov %rax, -32(%rbp)
+	mov -32(%rbp), %rax
+	mov %rax, %rdi
+	sar $63, %rdi
+	shr $61, %rdi
+	add %rdi, %rax
+	and $7, %rax
+	sub %rdi, %rax
+	mov %rax, %rsi
+	lea .L.L.32(%rip), %rax
+	mov %rax, %rdx
+	mov $-1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $-7, %rax
+	mov %eax, -24(%rbp)
+	movsxd -24(%rbp), %rax
+	shl $2, %rax
+	mov %rax, %rsi
+	lea .L.L.33(%rip), %rax
+	mov %rax, %rdx
+	mov $-28, %rdi
+	mov $0, %rax
+	call assert_
+	mov $-7, %rax
+	mov %eax, -20(%rbp)
+	movsxd -20(%rbp), %rax
+	imul $4, %rax
+	mov %rax, %rsi
+	lea .L.L.34(%rip), %rax
+	mov %rax, %rdx
+	mov $-28, %rdi
+	mov $0, %rax
+	call assert_
+	mov $7, %rax
+	mov %eax, -16(%rbp)
+	movsxd -16(%rbp), %rsi
+	lea .L.L.35(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rsi
+	lea .L.L.36(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %eax, -12(%rbp)
+	movsxd -12(%rbp), %rax
+	add $14, %eax
+	mov %rax, %rsi
+	lea .L.L.37(%rip), %rax
+	mov %rax, %rdx
+	mov $15, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -8(%rbp)
+	movsxd -8(%rbp), %rax
+	cmp $5, %rax
+	setg %al
+	movzb %al, %rax
+	mov %rax, %rsi
+	lea .L.L.38(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -4(%rbp)
+	movsxd -4(%rbp), %rax
+	cmp $2, %rax
+	setg %al
+	movzb %al, %rax
+	mov %rax, %rsi
+	lea .L.L.39(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	movsxd %eax, %r13
+	cmp $3, %r13
+	setge %al
+	movzb %al, %rax
+	mov %rax, %rsi
+	lea .L.L.40(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	movsxd %eax, %r14
+	mov $7, %r15
+	mov %r15, %rax
+	sub %r14, %rax
+	mov %rax, %rsi
+	lea .L.L.41(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.42(%rip), %rax
+	mov %rax, %rdi
+	mov $0, %rax
+	call printf
+	movsxd %eax, %rax
+	mov $0, %rax
+.L.return.main:
+	mov -72(%rbp), %r13
+	mov -80(%rbp), %r14
+	mov -88(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
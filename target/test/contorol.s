@@ -0,0 +1,2015 @@
+.data
+	.global .L.L.31
+.L.L.31:
+	.byte 79
+	.byte 75
+	.byte 10
+	.byte 0
+.data
+	.global .L.L.30
+.L.L.30:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.29
+.L.L.29:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 42
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.28
+.L.L.28:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 59
+	.byte 48
+	.byte 59
+	.byte 41
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 57
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.27
+.L.L.27:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 102
+	.byte 32
+	.byte 40
+	.byte 48
+	.byte 41
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 101
+	.byte 108
+	.byte 115
+	.byte 101
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.26
+.L.L.26:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 102
+	.byte 32
+	.byte 40
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 101
+	.byte 108
+	.byte 115
+	.byte 101
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.25
+.L.L.25:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 102
+	.byte 32
+	.byte 40
+	.byte 48
+	.byte 41
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.24
+.L.L.24:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 50
+	.byte 44
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 40
+	.byte 105
+	.byte 61
+	.byte 53
+	.byte 44
+	.byte 106
+	.byte 41
+	.byte 61
+	.byte 54
+	.byte 59
+	.byte 32
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.23
+.L.L.23:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 50
+	.byte 44
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 40
+	.byte 105
+	.byte 61
+	.byte 53
+	.byte 44
+	.byte 106
+	.byte 41
+	.byte 61
+	.byte 54
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.22
+.L.L.22:
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 50
+	.byte 44
+	.byte 51
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.21
+.L.L.21:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 104
+	.byte 111
+	.byte 114
+	.byte 116
+	.byte 32
+	.byte 99
+	.byte 61
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 115
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 60
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 115
+	.byte 61
+	.byte 115
+	.byte 43
+	.byte 40
+	.byte 99
+	.byte 42
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 41
+	.byte 42
+	.byte 105
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.20
+.L.L.20:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 99
+	.byte 61
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 115
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 60
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 115
+	.byte 61
+	.byte 115
+	.byte 43
+	.byte 40
+	.byte 99
+	.byte 43
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 41
+	.byte 42
+	.byte 105
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.19
+.L.L.19:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 107
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 60
+	.byte 107
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 106
+	.byte 47
+	.byte 107
+	.byte 59
+	.byte 32
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.18
+.L.L.18:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 107
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 109
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 60
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 109
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 109
+	.byte 60
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 109
+	.byte 61
+	.byte 109
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 106
+	.byte 43
+	.byte 107
+	.byte 42
+	.byte 53
+	.byte 47
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.17
+.L.L.17:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 107
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 60
+	.byte 49
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 106
+	.byte 43
+	.byte 107
+	.byte 42
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 107
+	.byte 61
+	.byte 107
+	.byte 43
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.16
+.L.L.16:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 107
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 60
+	.byte 49
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 106
+	.byte 43
+	.byte 107
+	.byte 42
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.15
+.L.L.15:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 102
+	.byte 32
+	.byte 40
+	.byte 51
+	.byte 33
+	.byte 61
+	.byte 120
+	.byte 41
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 101
+	.byte 108
+	.byte 115
+	.byte 101
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 57
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.14
+.L.L.14:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 102
+	.byte 32
+	.byte 40
+	.byte 51
+	.byte 61
+	.byte 61
+	.byte 120
+	.byte 41
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 57
+	.byte 59
+	.byte 32
+	.byte 101
+	.byte 108
+	.byte 115
+	.byte 101
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.13
+.L.L.13:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 102
+	.byte 32
+	.byte 40
+	.byte 120
+	.byte 60
+	.byte 61
+	.byte 48
+	.byte 41
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.12
+.L.L.12:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 119
+	.byte 104
+	.byte 105
+	.byte 108
+	.byte 101
+	.byte 32
+	.byte 40
+	.byte 48
+	.byte 41
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.11
+.L.L.11:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 60
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 106
+	.byte 43
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.10
+.L.L.10:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 105
+	.byte 61
+	.byte 49
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 62
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 45
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 106
+	.byte 43
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.9
+.L.L.9:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 119
+	.byte 104
+	.byte 105
+	.byte 108
+	.byte 101
+	.byte 40
+	.byte 105
+	.byte 60
+	.byte 61
+	.byte 49
+	.byte 48
+	.byte 41
+	.byte 32
+	.byte 123
+	.byte 106
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.8
+.L.L.8:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 119
+	.byte 104
+	.byte 105
+	.byte 108
+	.byte 101
+	.byte 40
+	.byte 105
+	.byte 60
+	.byte 49
+	.byte 48
+	.byte 41
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.7
+.L.L.7:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 59
+	.byte 59
+	.byte 59
+	.byte 32
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.6
+.L.L.6:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 123
+	.byte 50
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.5
+.L.L.5:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 119
+	.byte 104
+	.byte 105
+	.byte 108
+	.byte 101
+	.byte 40
+	.byte 105
+	.byte 60
+	.byte 49
+	.byte 48
+	.byte 41
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.4
+.L.L.4:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 60
+	.byte 61
+	.byte 49
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.3
+.L.L.3:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 102
+	.byte 32
+	.byte 40
+	.byte 50
+	.byte 45
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 101
+	.byte 108
+	.byte 115
+	.byte 101
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.2
+.L.L.2:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 102
+	.byte 32
+	.byte 40
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 101
+	.byte 108
+	.byte 115
+	.byte 101
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.1
+.L.L.1:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 102
+	.byte 32
+	.byte 40
+	.byte 49
+	.byte 45
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 101
+	.byte 108
+	.byte 115
+	.byte 101
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.0
+.L.L.0:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 102
+	.byte 32
+	.byte 40
+	.byte 48
+	.byte 41
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 101
+	.byte 108
+	.byte 115
+	.byte 101
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.text
+	.globl main
+main:
+	push %rbp
+	mov %rsp, %rbp
+	sub $224, %rsp
+	mov %rbx, -200(%rbp)
+	mov %r13, -208(%rbp)
+	mov %r14, -216(%rbp)
+	mov %r15, -224(%rbp)
+.L.body.main:
+	mov $3, %rax
+	mov %eax, -192(%rbp)
+	movsxd -192(%rbp), %rsi
+	lea .L.L.0(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -188(%rbp)
+	movsxd -188(%rbp), %rsi
+	lea .L.L.1(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rax
+	mov %eax, -184(%rbp)
+	movsxd -184(%rbp), %rsi
+	lea .L.L.2(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rax
+	mov %eax, -180(%rbp)
+	movsxd -180(%rbp), %rsi
+	lea .L.L.3(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -176(%rbp)
+	mov $0, %rax
+	mov %eax, -172(%rbp)
+	mov $0, %rax
+	mov %eax, -176(%rbp)
+	jmp .L.cond.1
+.L.begin.1:
+	movsxd -176(%rbp), %rax
+	add -172(%rbp), %eax
+	mov %eax, -172(%rbp)
+	movsxd -176(%rbp), %rax
+	add $1, %eax
+	mov %eax, -176(%rbp)
+.L.cond.1:
+	movsxd -176(%rbp), %rax
+	cmp $10, %eax
+	jle .L.begin.1
+	movsxd -172(%rbp), %rsi
+	lea .L.L.4(%rip), %rax
+	mov %rax, %rdx
+	mov $55, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -168(%rbp)
+	jmp .L.cond.2
+.L.begin.2:
+	movsxd -168(%rbp), %rax
+	add $1, %eax
+	mov %eax, -168(%rbp)
+.L.cond.2:
+	movsxd -168(%rbp), %rax
+	cmp $10, %eax
+	jl .L.begin.2
+	movsxd -168(%rbp), %rsi
+	lea .L.L.5(%rip), %rax
+	mov %rax, %rdx
+	mov $10, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rsi
+	lea .L.L.6(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $5, %rsi
+	lea .L.L.7(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -164(%rbp)
+	jmp .L.cond.3
+.L.begin.3:
+	movsxd -164(%rbp), %rax
+	add $1, %eax
+	mov %eax, -164(%rbp)
+.L.cond.3:
+	movsxd -164(%rbp), %rax
+	cmp $10, %eax
+	jl .L.begin.3
+	movsxd -164(%rbp), %rsi
+	lea .L.L.8(%rip), %rax
+	mov %rax, %rdx
+	mov $10, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -160(%rbp)
+	mov $0, %rax
+	mov %eax, -156(%rbp)
+	jmp .L.cond.4
+.L.begin.4:
+	movsxd -160(%rbp), %rax
+	add -156(%rbp), %eax
+	mov %eax, -156(%rbp)
+	movsxd -160(%rbp), %rax
+	add $1, %eax
+	mov %eax, -160(%rbp)
+.L.cond.4:
+	movsxd -160(%rbp), %rax
+	cmp $10, %eax
+	jle .L.begin.4
+	movsxd -156(%rbp), %rsi
+	lea .L.L.9(%rip), %rax
+	mov %rax, %rdx
+	mov $55, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -152(%rbp)
+	mov $0, %rax
+	mov %eax, -148(%rbp)
+	mov $10, %rax
+	mov %eax, -152(%rbp)
+	jmp .L.cond.5
+.L.begin.5:
+	movsxd -148(%rbp), %rax
+	add $1, %eax
+	mov %eax, -148(%rbp)
+	movsxd -152(%rbp), %rax
+	sub $1, %eax
+	mov %eax, -152(%rbp)
+.L.cond.5:
+	movsxd -152(%rbp), %rax
+	cmp $0, %rax
+	jg .L.begin.5
+	movsxd -148(%rbp), %rsi
+	lea .L.L.10(%rip), %rax
+	mov %rax, %rdx
+	mov $10, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -144(%rbp)
+	mov $0, %rax
+	mov %eax, -140(%rbp)
+	mov $0, %rax
+	mov %eax, -144(%rbp)
+	jmp .L.cond.6
+.L.begin.6:
+	movsxd -140(%rbp), %rax
+	add $1, %eax
+	mov %eax, -140(%rbp)
+	movsxd -144(%rbp), %rax
+	add $1, %eax
+	mov %eax, -144(%rbp)
+.L.cond.6:
+	movsxd -144(%rbp), %rax
+	cmp $0, %eax
+	jl .L.begin.6
+	movsxd -140(%rbp), %rsi
+	lea .L.L.11(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $5, %rax
+	mov %eax, -136(%rbp)
+	movsxd -136(%rbp), %rsi
+	lea .L.L.12(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -132(%rbp)
+	movsxd -132(%rbp), %rax
+	cmp $0, %eax
+	jg .L.else.7
+	mov $7, %rax
+	mov %eax, -132(%rbp)
+.L.else.7:
+.L.end.7:
+	movsxd -132(%rbp), %rsi
+	lea .L.L.13(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rax
+	mov %eax, -128(%rbp)
+	movsxd -128(%rbp), %rax
+	cmp $3, %rax
+	jne .L.else.8
+	mov $9, %rax
+	mov %eax, -128(%rbp)
+	jmp .L.end.8
+.L.else.8:
+	mov $3, %rax
+	mov %eax, -128(%rbp)
+.L.end.8:
+	movsxd -128(%rbp), %rsi
+	lea .L.L.14(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -124(%rbp)
+	movsxd -124(%rbp), %rax
+	cmp $3, %rax
+	je .L.else.9
+	mov $1, %rax
+	mov %eax, -124(%rbp)
+	jmp .L.end.9
+.L.else.9:
+	mov $9, %rax
+	mov %eax, -124(%rbp)
+.L.end.9:
+	movsxd -124(%rbp), %rsi
+	lea .L.L.15(%rip), %rax
+	mov %rax, %rdx
+	mov $9, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -120(%rbp)
+	mov $0, %rax
+	mov %eax, -116(%rbp)
+	mov $3, %rax
+	mov %eax, -112(%rbp)
+	mov $0, %rax
+	mov %eax, -120(%rbp)
+	movsxd -112(%rbp), %rax
+	shl $2, %rax
+	mov %eax, -16(%rbp)
+	jmp .L.cond.10
+.L.begin.10:
+	movsxd -116(%rbp), %rax
+	add -16(%rbp), %eax
+	mov %eax, -116(%rbp)
+	movsxd -120(%rbp), %rax
+	add $1, %eax
+	mov %eax, -120(%rbp)
+.L.cond.10:
+	movsxd -120(%rbp), %rax
+	cmp $10, %eax
+	jl .L.begin.10
+	movsxd -116(%rbp), %rsi
+	lea .L.L.16(%rip), %rax
+	mov %rax, %rdx
+	mov $120, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -108(%rbp)
+	mov $0, %rax
+	mov %eax, -104(%rbp)
+	mov $0, %rax
+	mov %eax, -100(%rbp)
+	mov $0, %rax
+	mov %eax, -108(%rbp)
+	jmp .L.cond.11
+.L.begin.11:
+	movsxd -104(%rbp), %rax
+	add -100(%rbp), %eax
+	mov %eax, -104(%rbp)
+	movsxd -100(%rbp), %rax
+	add $1, %eax
+	mov %eax, -100(%rbp)
+	movsxd -108(%rbp), %rax
+	add $1, %eax
+	mov %eax, -108(%rbp)
+.L.cond.11:
+	movsxd -108(%rbp), %rax
+	cmp $10, %eax
+	jl .L.begin.11
+	movsxd -104(%rbp), %rsi
+	lea .L.L.17(%rip), %rax
+	mov %rax, %rdx
+	mov $45, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -96(%rbp)
+	mov $0, %rax
+	movsxd %eax, %r14
+	mov $3, %rax
+	mov %eax, -92(%rbp)
+	mov $0, %rax
+	movsxd %eax, %r15
+	mov $0, %rax
+	mov %eax, -96(%rbp)
+	mov $3, %rbx
+	movsxd -92(%rbp), %rax
+	imul $5, %eax
+	cdq
+	idiv %ebx
+	mov %eax, -12(%rbp)
+	jmp .L.cond.12
+.L.begin.12:
+	mov $0, %rax
+	movsxd %eax, %r15
+	movsxd -12(%rbp), %rax
+	movsxd %eax, %r13
+	jmp .L.cond.13
+.L.begin.13:
+	mov %r14, %rax
+	add %r13d, %eax
+	movsxd %eax, %r14
+	mov %r15, %rax
+	add $1, %eax
+	movsxd %eax, %r15
+.L.cond.13:
+	cmp $4, %r15d
+	jl .L.begin.13
+	movsxd -96(%rbp), %rax
+	add $1, %eax
+	mov %eax, -96(%rbp)
+.L.cond.12:
+	movsxd -96(%rbp), %rax
+	cmp $3, %eax
+	jl .L.begin.12
+	mov %r14, %rsi
+	lea .L.L.18(%rip), %rax
+	mov %rax, %rdx
+	mov $60, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -88(%rbp)
+	mov $2, %rax
+	mov %eax, -84(%rbp)
+	mov $0, %rax
+	mov %eax, -80(%rbp)
+	mov $0, %rax
+	mov %eax, -88(%rbp)
+	jmp .L.cond.14
+.L.begin.14:
+	movsxd -80(%rbp), %rbx
+	movsxd -84(%rbp), %rax
+	cdq
+	idiv %ebx
+	mov %eax, -84(%rbp)
+	movsxd -88(%rbp), %rax
+	add $1, %eax
+	mov %eax, -88(%rbp)
+.L.cond.14:
+	movsxd -88(%rbp), %rax
+	cmp -80(%rbp), %eax
+	jl .L.begin.14
+	movsxd -84(%rbp), %rsi
+	lea .L.L.19(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $100, %rax
+	mov %al, -73(%rbp)
+	mov $0, %rax
+	mov %eax, -72(%rbp)
+	mov $0, %rax
+	mov %eax, -68(%rbp)
+	mov $0, %rax
+	mov %eax, -72(%rbp)
+	movsbq -73(%rbp), %rax
+	add $100, %eax
+	mov %eax, -8(%rbp)
+	jmp .L.cond.15
+.L.begin.15:
+	movsxd -8(%rbp), %rax
+	imul -72(%rbp), %eax
+	add -68(%rbp), %eax
+	mov %eax, -68(%rbp)
+	movsxd -72(%rbp), %rax
+	add $1, %eax
+	mov %eax, -72(%rbp)
+.L.cond.15:
+	movsxd -72(%rbp), %rax
+	cmp $3, %eax
+	jl .L.begin.15
+	movsxd -68(%rbp), %rsi
+	lea .L.L.20(%rip), %rax
+	mov %rax, %rdx
+	mov $600, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1000, %rax
+	mov %ax, -62(%rbp)
+	mov $0, %rax
+	mov %eax, -60(%rbp)
+	mov $0, %rax
+	mov %eax, -56(%rbp)
+	mov $0, %rax
+	mov %eax, -60(%rbp)
+	movswq -62(%rbp), %rax
+	imul $100, %eax
+	mov %eax, -4(%rbp)
+	jmp .L.cond.16
+.L.begin.16:
+	movsxd -4(%rbp), %rax
+	imul -60(%rbp), %eax
+	add -56(%rbp), %eax
+	mov %eax, -56(%rbp)
+	movsxd -60(%rbp), %rax
+	add $1, %eax
+	mov %eax, -60(%rbp)
+.L.cond.16:
+	movsxd -60(%rbp), %rax
+	cmp $3, %eax
+	jl .L.begin.16
+	movsxd -56(%rbp), %rsi
+	lea .L.L.21(%rip), %rax
+	mov %rax, %rdx
+	mov $300000, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov $2, %rax
+	mov $3, %rsi
+	lea .L.L.22(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rax
+	mov %eax, -52(%rbp)
+	mov $3, %rax
+	mov %eax, -48(%rbp)
+	mov $5, %rax
+	mov %eax, -52(%rbp)
+	lea -48(%rbp), %rax
+	mov %rax, %rbx
+	mov $6, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	movsxd -52(%rbp), %rsi
+	lea .L.L.23(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -40(%rbp)
+	mov $5, %rax
+	mov %eax, -44(%rbp)
+	lea -40(%rbp), %rax
+	mov %rax, %rbx
+	mov $6, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	movsxd -40(%rbp), %rsi
+	lea .L.L.24(%rip), %rax
+	mov %rax, %rdx
+	mov $6, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -36(%rbp)
+	movsxd -36(%rbp), %rsi
+	lea .L.L.25(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -32(%rbp)
+	mov $5, %rax
+	mov %eax, -32(%rbp)
+	movsxd -32(%rbp), %rsi
+	lea .L.L.26(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -28(%rbp)
+	mov $7, %rax
+	mov %eax, -28(%rbp)
+	movsxd -28(%rbp), %rsi
+	lea .L.L.27(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rax
+	mov %eax, -24(%rbp)
+	movsxd -24(%rbp), %rsi
+	lea .L.L.28(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rax
+	mov %eax, -20(%rbp)
+	movsxd -20(%rbp), %rsi
+	lea .L.L.29(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $5, %rsi
+	lea .L.L.30(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.31(%rip), %rax
+	mov %rax, %rdi
+	mov $0, %rax
+	call printf
+	movsxd %eax, %rax
+	mov $0, %rax
+.L.return.main:
+	mov -200(%rbp), %rbx
+	mov -208(%rbp), %r13
+	mov -216(%rbp), %r14
+	mov -224(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
@@ -0,0 +1,284 @@
+.data
+	.global .L.L.7
+.L.L.7:
+	.byte 79
+	.byte 75
+	.byte 10
+	.byte 0
+.data
+	.global .L.L.6
+.L.L.6:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.5
+.L.L.5:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.4
+.L.L.4:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.3
+.L.L.3:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.2
+.L.L.2:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 115
+	.byte 104
+	.byte 111
+	.byte 114
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.1
+.L.L.1:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 104
+	.byte 111
+	.byte 114
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.0
+.L.L.0:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.text
+	.globl main
+main:
+	push %rbp
+	mov %rsp, %rbp
+	sub $0, %rsp
+.L.body.main:
+	mov $1, %rsi
+	lea .L.L.0(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rsi
+	lea .L.L.1(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rsi
+	lea .L.L.2(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.3(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.4(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.5(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.6(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.7(%rip), %rax
+	mov %rax, %rdi
+	mov $0, %rax
+	call printf
+	movsxd %eax, %rax
+	mov $0, %rax
+.L.return.main:
+	mov %rbp, %rsp
+	pop %rbp
+	ret
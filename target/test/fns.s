@@ -0,0 +1,3560 @@
+.data
+	.global .L.L.51
+.L.L.51:
+	.byte 79
+	.byte 75
+	.byte 10
+	.byte 0
+.data
+	.global .L.L.50
+.L.L.50:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 51
+	.byte 48
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 117
+	.byte 109
+	.byte 95
+	.byte 108
+	.byte 101
+	.byte 97
+	.byte 102
+	.byte 40
+	.byte 50
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.49
+.L.L.49:
+	.byte 115
+	.byte 117
+	.byte 109
+	.byte 95
+	.byte 108
+	.byte 101
+	.byte 97
+	.byte 102
+	.byte 40
+	.byte 50
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.48
+.L.L.48:
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 111
+	.byte 100
+	.byte 100
+	.byte 40
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.47
+.L.L.47:
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 101
+	.byte 118
+	.byte 101
+	.byte 110
+	.byte 40
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.46
+.L.L.46:
+	.byte 99
+	.byte 111
+	.byte 117
+	.byte 110
+	.byte 116
+	.byte 95
+	.byte 100
+	.byte 111
+	.byte 119
+	.byte 110
+	.byte 40
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.45
+.L.L.45:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 66
+	.byte 105
+	.byte 103
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 66
+	.byte 105
+	.byte 103
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 109
+	.byte 97
+	.byte 107
+	.byte 101
+	.byte 95
+	.byte 98
+	.byte 105
+	.byte 103
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 32
+	.byte 50
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 115
+	.byte 99
+	.byte 97
+	.byte 108
+	.byte 101
+	.byte 95
+	.byte 98
+	.byte 105
+	.byte 103
+	.byte 40
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 120
+	.byte 44
+	.byte 32
+	.byte 49
+	.byte 48
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 99
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.44
+.L.L.44:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 66
+	.byte 105
+	.byte 103
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 115
+	.byte 99
+	.byte 97
+	.byte 108
+	.byte 101
+	.byte 95
+	.byte 98
+	.byte 105
+	.byte 103
+	.byte 40
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 109
+	.byte 97
+	.byte 107
+	.byte 101
+	.byte 95
+	.byte 98
+	.byte 105
+	.byte 103
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 32
+	.byte 50
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 49
+	.byte 48
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 32
+	.byte 43
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 32
+	.byte 43
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 99
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.43
+.L.L.43:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 66
+	.byte 105
+	.byte 103
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 109
+	.byte 97
+	.byte 107
+	.byte 101
+	.byte 95
+	.byte 98
+	.byte 105
+	.byte 103
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 32
+	.byte 50
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 117
+	.byte 109
+	.byte 95
+	.byte 98
+	.byte 105
+	.byte 103
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 32
+	.byte 50
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 44
+	.byte 32
+	.byte 52
+	.byte 44
+	.byte 32
+	.byte 53
+	.byte 44
+	.byte 32
+	.byte 120
+	.byte 44
+	.byte 32
+	.byte 109
+	.byte 97
+	.byte 107
+	.byte 101
+	.byte 95
+	.byte 112
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 40
+	.byte 50
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 41
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.42
+.L.L.42:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 66
+	.byte 105
+	.byte 103
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 109
+	.byte 97
+	.byte 107
+	.byte 101
+	.byte 95
+	.byte 98
+	.byte 105
+	.byte 103
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 32
+	.byte 50
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 32
+	.byte 43
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 32
+	.byte 43
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 99
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.41
+.L.L.41:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 84
+	.byte 114
+	.byte 105
+	.byte 32
+	.byte 116
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 110
+	.byte 101
+	.byte 120
+	.byte 116
+	.byte 95
+	.byte 116
+	.byte 114
+	.byte 105
+	.byte 40
+	.byte 116
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.40
+.L.L.40:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 84
+	.byte 114
+	.byte 105
+	.byte 32
+	.byte 116
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 110
+	.byte 101
+	.byte 120
+	.byte 116
+	.byte 95
+	.byte 116
+	.byte 114
+	.byte 105
+	.byte 40
+	.byte 116
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 117
+	.byte 109
+	.byte 95
+	.byte 116
+	.byte 114
+	.byte 105
+	.byte 40
+	.byte 116
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.39
+.L.L.39:
+	.byte 115
+	.byte 99
+	.byte 97
+	.byte 108
+	.byte 101
+	.byte 95
+	.byte 98
+	.byte 105
+	.byte 103
+	.byte 40
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 109
+	.byte 97
+	.byte 107
+	.byte 101
+	.byte 95
+	.byte 98
+	.byte 105
+	.byte 103
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 32
+	.byte 50
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 49
+	.byte 48
+	.byte 41
+	.byte 46
+	.byte 99
+	.byte 0
+.data
+	.global .L.L.38
+.L.L.38:
+	.byte 115
+	.byte 119
+	.byte 97
+	.byte 112
+	.byte 95
+	.byte 112
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 40
+	.byte 109
+	.byte 97
+	.byte 107
+	.byte 101
+	.byte 95
+	.byte 112
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 40
+	.byte 53
+	.byte 44
+	.byte 32
+	.byte 49
+	.byte 50
+	.byte 41
+	.byte 41
+	.byte 46
+	.byte 97
+	.byte 0
+.data
+	.global .L.L.37
+.L.L.37:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 80
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 32
+	.byte 112
+	.byte 59
+	.byte 32
+	.byte 112
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 115
+	.byte 119
+	.byte 97
+	.byte 112
+	.byte 95
+	.byte 112
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 40
+	.byte 109
+	.byte 97
+	.byte 107
+	.byte 101
+	.byte 95
+	.byte 112
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 40
+	.byte 53
+	.byte 44
+	.byte 32
+	.byte 49
+	.byte 50
+	.byte 41
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 112
+	.byte 46
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.36
+.L.L.36:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 80
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 32
+	.byte 112
+	.byte 59
+	.byte 32
+	.byte 112
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 115
+	.byte 119
+	.byte 97
+	.byte 112
+	.byte 95
+	.byte 112
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 40
+	.byte 109
+	.byte 97
+	.byte 107
+	.byte 101
+	.byte 95
+	.byte 112
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 40
+	.byte 53
+	.byte 44
+	.byte 32
+	.byte 49
+	.byte 50
+	.byte 41
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 112
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.35
+.L.L.35:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 80
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 32
+	.byte 112
+	.byte 59
+	.byte 32
+	.byte 112
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 109
+	.byte 97
+	.byte 107
+	.byte 101
+	.byte 95
+	.byte 112
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 40
+	.byte 53
+	.byte 44
+	.byte 32
+	.byte 57
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 117
+	.byte 109
+	.byte 95
+	.byte 112
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 40
+	.byte 49
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 112
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.34
+.L.L.34:
+	.byte 109
+	.byte 97
+	.byte 107
+	.byte 101
+	.byte 95
+	.byte 112
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 40
+	.byte 55
+	.byte 44
+	.byte 32
+	.byte 57
+	.byte 41
+	.byte 46
+	.byte 98
+	.byte 0
+.data
+	.global .L.L.33
+.L.L.33:
+	.byte 109
+	.byte 97
+	.byte 107
+	.byte 101
+	.byte 95
+	.byte 112
+	.byte 97
+	.byte 105
+	.byte 114
+	.byte 40
+	.byte 55
+	.byte 44
+	.byte 32
+	.byte 57
+	.byte 41
+	.byte 46
+	.byte 97
+	.byte 0
+.data
+	.global .L.L.32
+.L.L.32:
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 56
+	.byte 40
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 56
+	.byte 40
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 45
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 50
+	.byte 40
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 41
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.31
+.L.L.31:
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 54
+	.byte 40
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 54
+	.byte 40
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 50
+	.byte 40
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 41
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.30
+.L.L.30:
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 56
+	.byte 40
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 44
+	.byte 32
+	.byte 55
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 41
+	.byte 32
+	.byte 43
+	.byte 32
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 50
+	.byte 40
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 48
+	.byte 41
+	.byte 32
+	.byte 45
+	.byte 32
+	.byte 52
+	.byte 0
+.data
+	.global .L.L.29
+.L.L.29:
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 54
+	.byte 40
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.28
+.L.L.28:
+	.byte 105
+	.byte 115
+	.byte 95
+	.byte 97
+	.byte 108
+	.byte 105
+	.byte 103
+	.byte 110
+	.byte 101
+	.byte 100
+	.byte 40
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.27
+.L.L.27:
+	.byte 114
+	.byte 101
+	.byte 116
+	.byte 95
+	.byte 110
+	.byte 101
+	.byte 103
+	.byte 95
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 40
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.26
+.L.L.26:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 117
+	.byte 102
+	.byte 91
+	.byte 51
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 112
+	.byte 114
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 102
+	.byte 40
+	.byte 98
+	.byte 117
+	.byte 102
+	.byte 44
+	.byte 32
+	.byte 34
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 34
+	.byte 44
+	.byte 32
+	.byte 49
+	.byte 44
+	.byte 50
+	.byte 44
+	.byte 51
+	.byte 44
+	.byte 52
+	.byte 44
+	.byte 53
+	.byte 44
+	.byte 54
+	.byte 44
+	.byte 55
+	.byte 56
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 98
+	.byte 117
+	.byte 102
+	.byte 91
+	.byte 55
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.25
+.L.L.25:
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 0
+.data
+	.global .L.L.24
+.L.L.24:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 117
+	.byte 102
+	.byte 91
+	.byte 51
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 112
+	.byte 114
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 102
+	.byte 40
+	.byte 98
+	.byte 117
+	.byte 102
+	.byte 44
+	.byte 32
+	.byte 34
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 34
+	.byte 44
+	.byte 32
+	.byte 49
+	.byte 44
+	.byte 50
+	.byte 44
+	.byte 51
+	.byte 44
+	.byte 52
+	.byte 44
+	.byte 53
+	.byte 44
+	.byte 54
+	.byte 44
+	.byte 55
+	.byte 56
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.23
+.L.L.23:
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 37
+	.byte 100
+	.byte 0
+.data
+	.global .L.L.22
+.L.L.22:
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 49
+	.byte 48
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 50
+	.byte 44
+	.byte 51
+	.byte 44
+	.byte 52
+	.byte 44
+	.byte 53
+	.byte 44
+	.byte 54
+	.byte 44
+	.byte 55
+	.byte 44
+	.byte 56
+	.byte 44
+	.byte 57
+	.byte 44
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 56
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 49
+	.byte 44
+	.byte 49
+	.byte 44
+	.byte 49
+	.byte 44
+	.byte 49
+	.byte 44
+	.byte 49
+	.byte 44
+	.byte 49
+	.byte 48
+	.byte 44
+	.byte 48
+	.byte 41
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.21
+.L.L.21:
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 49
+	.byte 48
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 50
+	.byte 44
+	.byte 51
+	.byte 44
+	.byte 52
+	.byte 44
+	.byte 53
+	.byte 44
+	.byte 54
+	.byte 44
+	.byte 55
+	.byte 44
+	.byte 56
+	.byte 44
+	.byte 57
+	.byte 44
+	.byte 49
+	.byte 48
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.20
+.L.L.20:
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 56
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 50
+	.byte 44
+	.byte 51
+	.byte 44
+	.byte 52
+	.byte 44
+	.byte 53
+	.byte 44
+	.byte 54
+	.byte 44
+	.byte 55
+	.byte 44
+	.byte 56
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.19
+.L.L.19:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 98
+	.byte 117
+	.byte 109
+	.byte 112
+	.byte 40
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 98
+	.byte 117
+	.byte 109
+	.byte 112
+	.byte 40
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 98
+	.byte 117
+	.byte 109
+	.byte 112
+	.byte 101
+	.byte 100
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.18
+.L.L.18:
+	.byte 114
+	.byte 101
+	.byte 116
+	.byte 95
+	.byte 115
+	.byte 104
+	.byte 111
+	.byte 114
+	.byte 116
+	.byte 40
+	.byte 55
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.17
+.L.L.17:
+	.byte 114
+	.byte 101
+	.byte 116
+	.byte 95
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 40
+	.byte 50
+	.byte 53
+	.byte 53
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.16
+.L.L.16:
+	.byte 114
+	.byte 101
+	.byte 116
+	.byte 95
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 40
+	.byte 51
+	.byte 48
+	.byte 48
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.15
+.L.L.15:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 101
+	.byte 116
+	.byte 95
+	.byte 116
+	.byte 111
+	.byte 40
+	.byte 38
+	.byte 97
+	.byte 44
+	.byte 32
+	.byte 57
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.14
+.L.L.14:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 113
+	.byte 95
+	.byte 112
+	.byte 108
+	.byte 117
+	.byte 115
+	.byte 40
+	.byte 121
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.13
+.L.L.13:
+	.byte 115
+	.byte 113
+	.byte 95
+	.byte 112
+	.byte 108
+	.byte 117
+	.byte 115
+	.byte 40
+	.byte 115
+	.byte 113
+	.byte 95
+	.byte 112
+	.byte 108
+	.byte 117
+	.byte 115
+	.byte 40
+	.byte 50
+	.byte 41
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.12
+.L.L.12:
+	.byte 115
+	.byte 113
+	.byte 95
+	.byte 112
+	.byte 108
+	.byte 117
+	.byte 115
+	.byte 40
+	.byte 51
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.11
+.L.L.11:
+	.byte 115
+	.byte 117
+	.byte 98
+	.byte 95
+	.byte 115
+	.byte 104
+	.byte 111
+	.byte 114
+	.byte 116
+	.byte 40
+	.byte 55
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.10
+.L.L.10:
+	.byte 115
+	.byte 117
+	.byte 98
+	.byte 95
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 40
+	.byte 55
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.9
+.L.L.9:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 117
+	.byte 98
+	.byte 95
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 40
+	.byte 55
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.8
+.L.L.8:
+	.byte 102
+	.byte 105
+	.byte 98
+	.byte 40
+	.byte 57
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.7
+.L.L.7:
+	.byte 115
+	.byte 117
+	.byte 98
+	.byte 50
+	.byte 40
+	.byte 52
+	.byte 44
+	.byte 51
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.6
+.L.L.6:
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 50
+	.byte 40
+	.byte 51
+	.byte 44
+	.byte 52
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.5
+.L.L.5:
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 54
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 50
+	.byte 44
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 54
+	.byte 40
+	.byte 51
+	.byte 44
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 54
+	.byte 40
+	.byte 52
+	.byte 44
+	.byte 53
+	.byte 44
+	.byte 54
+	.byte 44
+	.byte 55
+	.byte 44
+	.byte 56
+	.byte 44
+	.byte 57
+	.byte 41
+	.byte 44
+	.byte 49
+	.byte 48
+	.byte 44
+	.byte 49
+	.byte 49
+	.byte 44
+	.byte 49
+	.byte 50
+	.byte 44
+	.byte 49
+	.byte 51
+	.byte 41
+	.byte 44
+	.byte 49
+	.byte 52
+	.byte 44
+	.byte 49
+	.byte 53
+	.byte 44
+	.byte 49
+	.byte 54
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.4
+.L.L.4:
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 54
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 50
+	.byte 44
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 54
+	.byte 40
+	.byte 51
+	.byte 44
+	.byte 52
+	.byte 44
+	.byte 53
+	.byte 44
+	.byte 54
+	.byte 44
+	.byte 55
+	.byte 44
+	.byte 56
+	.byte 41
+	.byte 44
+	.byte 57
+	.byte 44
+	.byte 49
+	.byte 48
+	.byte 44
+	.byte 49
+	.byte 49
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.3
+.L.L.3:
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 54
+	.byte 40
+	.byte 49
+	.byte 44
+	.byte 50
+	.byte 44
+	.byte 51
+	.byte 44
+	.byte 52
+	.byte 44
+	.byte 53
+	.byte 44
+	.byte 54
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.2
+.L.L.2:
+	.byte 115
+	.byte 117
+	.byte 98
+	.byte 50
+	.byte 40
+	.byte 53
+	.byte 44
+	.byte 32
+	.byte 51
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.1
+.L.L.1:
+	.byte 97
+	.byte 100
+	.byte 100
+	.byte 50
+	.byte 40
+	.byte 51
+	.byte 44
+	.byte 32
+	.byte 53
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.0
+.L.L.0:
+	.byte 114
+	.byte 101
+	.byte 116
+	.byte 51
+	.byte 40
+	.byte 41
+	.byte 0
+.data
+	.global bumped
+bumped:
+	.zero 4
+.text
+	.globl main
+main:
+	push %rbp
+	mov %rsp, %rbp
+	sub $912, %rsp
+	mov %rbx, -888(%rbp)
+	mov %r13, -896(%rbp)
+	mov %r14, -904(%rbp)
+	mov %r15, -912(%rbp)
+.L.body.main:
+	mov $3, %rsi
+	lea .L.L.0(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.1(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rsi
+	lea .L.L.2(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $21, %rsi
+	lea .L.L.3(%rip), %rax
+	mov %rax, %rdx
+	mov $21, %rdi
+	mov $0, %rax
+	call assert_
+	mov $33, %rax
+	mov %eax, -256(%rbp)
+	mov $3, %rax
+	add -256(%rbp), %eax
+	add $30, %eax
+	mov %rax, %rsi
+	lea .L.L.4(%rip), %rax
+	mov %rax, %rdx
+	mov $66, %rdi
+	mov $0, %rax
+	call assert_
+	mov $39, %rax
+	mov %eax, -252(%rbp)
+	mov $3, %rax
+	add -252(%rbp), %eax
+	add $46, %eax
+	mov %eax, -248(%rbp)
+	mov $3, %rax
+	add -248(%rbp), %eax
+	add $45, %eax
+	mov %rax, %rsi
+	lea .L.L.5(%rip), %rax
+	mov %rax, %rdx
+	mov $136, %rdi
+	mov $0, %rax
+	call assert_
+	mov $7, %rsi
+	lea .L.L.6(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.7(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $9, %rdi
+	mov $0, %rax
+	call fib
+	movsxd %eax, %rbx
+	lea .L.L.8(%rip), %rax
+	mov %rax, %rdx
+	mov $55, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.9(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %eax, -244(%rbp)
+	movsxd -244(%rbp), %rsi
+	lea .L.L.10(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.11(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $9, %rax
+	mov %eax, -240(%rbp)
+	movsxd -240(%rbp), %rax
+	add $1, %eax
+	mov %rax, %rsi
+	lea .L.L.12(%rip), %rax
+	mov %rax, %rdx
+	mov $10, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rax
+	mov %eax, -236(%rbp)
+	movsxd -236(%rbp), %rax
+	add $1, %eax
+	movsxd %eax, %r14
+	mov %r14, %rax
+	imul %r14d, %eax
+	mov %eax, -232(%rbp)
+	movsxd -232(%rbp), %rax
+	add $1, %eax
+	mov %rax, %rsi
+	lea .L.L.13(%rip), %rax
+	mov %rax, %rdx
+	mov $26, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	movsxd %eax, %r15
+	mov %r15, %rax
+	imul %r15d, %eax
+	mov %eax, -228(%rbp)
+	movsxd -228(%rbp), %rax
+	add $1, %eax
+	mov %r15, %rsi
+	lea .L.L.14(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -876(%rbp)
+	lea -876(%rbp), %rax
+	mov %rax, -224(%rbp)
+	mov -224(%rbp), %rbx
+	mov $9, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov $0, %rax
+	movsxd -876(%rbp), %rsi
+	lea .L.L.15(%rip), %rax
+	mov %rax, %rdx
+	mov $9, %rdi
+	mov $0, %rax
+	call assert_
+	mov $300, %rax
+	mov %al, -216(%rbp)
+	movsbq -216(%rbp), %rsi
+	lea .L.L.16(%rip), %rax
+	mov %rax, %rdx
+	mov $44, %rdi
+	mov $0, %rax
+	call assert_
+	mov $255, %rax
+	mov %al, -215(%rbp)
+	movsbq -215(%rbp), %rsi
+	lea .L.L.17(%rip), %rax
+	mov %rax, %rdx
+	mov $-1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $70000, %rax
+	mov %ax, -214(%rbp)
+	movswq -214(%rbp), %rax
+	add $1, %eax
+	mov %rax, %rsi
+	lea .L.L.18(%rip), %rax
+	mov %rax, %rdx
+	mov $4465, %rdi
+	mov $0, %rax
+	call assert_
+	movsxd bumped(%rip), %rax
+	add $1, %eax
+	mov %eax, bumped(%rip)
+	mov $7, %rax
+	movsxd bumped(%rip), %rax
+	add $1, %eax
+	mov %eax, bumped(%rip)
+	mov $7, %rax
+	movsxd bumped(%rip), %rsi
+	lea .L.L.19(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $-4, %rsi
+	lea .L.L.20(%rip), %rax
+	mov %rax, %rdx
+	mov $-4, %rdi
+	mov $0, %rax
+	call assert_
+	sub $32, %rsp
+	mov $7, %rax
+	mov %rax, 0(%rsp)
+	mov $8, %rax
+	mov %rax, 8(%rsp)
+	mov $9, %rax
+	mov %rax, 16(%rsp)
+	mov $10, %rax
+	mov %rax, 24(%rsp)
+	mov $2, %rsi
+	mov $4, %rcx
+	mov $5, %r8
+	mov $6, %r9
+	mov $3, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call add10
+	add $32, %rsp
+	movsxd %eax, %rbx
+	lea .L.L.21(%rip), %rax
+	mov %rax, %rdx
+	mov $55, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	sub $32, %rsp
+	mov $7, %rax
+	mov %rax, 0(%rsp)
+	mov $8, %rax
+	mov %rax, 8(%rsp)
+	mov $9, %rax
+	mov %rax, 16(%rsp)
+	mov $10, %rax
+	mov %rax, 24(%rsp)
+	mov $2, %rsi
+	mov $4, %rcx
+	mov $5, %r8
+	mov $6, %r9
+	mov $3, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call add10
+	add $32, %rsp
+	movsxd %eax, %rbx
+	lea .L.L.22(%rip), %rax
+	mov %rax, %rdx
+	mov $55, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	sub $32, %rsp
+	mov $5, %rax
+	mov %rax, 0(%rsp)
+	mov $6, %rax
+	mov %rax, 8(%rsp)
+	mov $78, %rax
+	mov %rax, 16(%rsp)
+	lea .L.L.23(%rip), %rax
+	mov %rax, %rsi
+	mov $2, %rcx
+	mov $3, %r8
+	mov $4, %r9
+	mov $1, %rdx
+	lea -872(%rbp), %rax
+	mov %rax, %rdi
+	mov $0, %rax
+	call sprintf
+	add $32, %rsp
+	movsxd %eax, %rbx
+	lea .L.L.24(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	sub $32, %rsp
+	mov $5, %rax
+	mov %rax, 0(%rsp)
+	mov $6, %rax
+	mov %rax, 8(%rsp)
+	mov $78, %rax
+	mov %rax, 16(%rsp)
+	lea .L.L.25(%rip), %rax
+	mov %rax, %rsi
+	mov $2, %rcx
+	mov $3, %r8
+	mov $4, %r9
+	mov $1, %rdx
+	lea -840(%rbp), %rax
+	mov %rax, %rdi
+	mov $0, %rax
+	call sprintf
+	add $32, %rsp
+	movsxd %eax, %rax
+	lea -840(%rbp), %rax
+	add $7, %rax
+	movsbq (%rax), %rbx
+	lea .L.L.26(%rip), %rax
+	mov %rax, %rdx
+	mov $56, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	call ret_neg_char
+	movsbq %al, %rbx
+	lea .L.L.27(%rip), %rax
+	mov %rax, %rdx
+	mov $-3, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rbx
+	lea .L.L.28(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -212(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -208(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -204(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -200(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -196(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -192(%rbp)
+	movsxd -212(%rbp), %rax
+	add -208(%rbp), %eax
+	add -204(%rbp), %eax
+	add -200(%rbp), %eax
+	add -196(%rbp), %eax
+	add -192(%rbp), %eax
+	mov %rax, %rbx
+	lea .L.L.29(%rip), %rax
+	mov %rax, %rdx
+	mov $6, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -176(%rbp)
+	movsxd -176(%rbp), %rbx
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -188(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -184(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -180(%rbp)
+	movsxd -188(%rbp), %rax
+	add -184(%rbp), %eax
+	add -180(%rbp), %eax
+	add $7, %eax
+	add %ebx, %eax
+	sub $4, %eax
+	mov %rax, %rbx
+	lea .L.L.30(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -160(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -156(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -152(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -148(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -144(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -168(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -172(%rbp)
+	movsxd -172(%rbp), %rax
+	mov %eax, -164(%rbp)
+	movsxd -168(%rbp), %rax
+	add -164(%rbp), %eax
+	mov %eax, -140(%rbp)
+	movsxd -160(%rbp), %rax
+	add -156(%rbp), %eax
+	add -152(%rbp), %eax
+	add -148(%rbp), %eax
+	add -144(%rbp), %eax
+	add -140(%rbp), %eax
+	mov %rax, %rbx
+	lea .L.L.31(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %al, -129(%rbp)
+	mov $0, %rax
+	call is_aligned
+	movsxd %eax, %rax
+	mov %eax, -136(%rbp)
+	movsxd -136(%rbp), %rax
+	neg %rax
+	mov %rax, -128(%rbp)
+	movsbq -129(%rbp), %rax
+	sub -128(%rbp), %eax
+	movsbq %al, %r13
+	mov %r13, %rbx
+	lea .L.L.32(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $9, %rsi
+	mov $7, %rdi
+	mov $0, %rax
+	call make_pair
+	mov %rax, -808(%rbp)
+	lea -808(%rbp), %rax
+	movsbq 0(%rax), %rbx
+	lea .L.L.33(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $9, %rsi
+	mov $7, %rdi
+	mov $0, %rax
+	call make_pair
+	mov %rax, -800(%rbp)
+	lea -800(%rbp), %rax
+	movsxd 4(%rax), %rbx
+	lea .L.L.34(%rip), %rax
+	mov %rax, %rdx
+	mov $9, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $9, %rsi
+	mov $5, %rdi
+	mov $0, %rax
+	call make_pair
+	mov %rax, -784(%rbp)
+	lea -784(%rbp), %rax
+	lea -792(%rbp), %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	lea -792(%rbp), %rax
+	mov 0(%rax), %rsi
+	mov $10, %rdi
+	mov $0, %rax
+	call sum_pair
+	movsxd %eax, %rbx
+	lea .L.L.35(%rip), %rax
+	mov %rax, %rdx
+	mov $24, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $12, %rsi
+	mov $5, %rdi
+	mov $0, %rax
+	call make_pair
+	mov %rax, -760(%rbp)
+	lea -760(%rbp), %rax
+	lea -112(%rbp), %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	movsxd -108(%rbp), %rax
+	mov %al, -120(%rbp)
+	movsbq -112(%rbp), %rax
+	mov %eax, -116(%rbp)
+	lea -120(%rbp), %rax
+	lea -776(%rbp), %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	movsbq -776(%rbp), %rbx
+	lea .L.L.36(%rip), %rax
+	mov %rax, %rdx
+	mov $12, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $12, %rsi
+	mov $5, %rdi
+	mov $0, %rax
+	call make_pair
+	mov %rax, -736(%rbp)
+	lea -736(%rbp), %rax
+	lea -96(%rbp), %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	movsxd -92(%rbp), %rax
+	mov %al, -104(%rbp)
+	movsbq -96(%rbp), %rax
+	mov %eax, -100(%rbp)
+	lea -104(%rbp), %rax
+	lea -752(%rbp), %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	movsxd -748(%rbp), %rbx
+	lea .L.L.37(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $12, %rsi
+	mov $5, %rdi
+	mov $0, %rax
+	call make_pair
+	mov %rax, -720(%rbp)
+	lea -720(%rbp), %rax
+	lea -80(%rbp), %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	movsxd -76(%rbp), %rax
+	mov %al, -88(%rbp)
+	movsbq -80(%rbp), %rax
+	mov %eax, -84(%rbp)
+	lea -88(%rbp), %rax
+	movsbq 0(%rax), %rbx
+	lea .L.L.38(%rip), %rax
+	mov %rax, %rdx
+	mov $12, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	mov $3, %rcx
+	mov $2, %rax
+	mov %rax, %rdx
+	lea -688(%rbp), %rdi
+	mov $0, %rax
+	call make_big
+	lea -688(%rbp), %rax
+	lea -72(%rbp), %rdi
+	movdqu 0(%rax), %xmm0
+	movdqu %xmm0, 0(%rdi)
+	mov 16(%rax), %r8
+	mov %r8, 16(%rdi)
+	mov -72(%rbp), %rax
+	imul $10, %rax
+	mov %rax, -72(%rbp)
+	mov -64(%rbp), %rax
+	imul $10, %rax
+	mov %rax, -64(%rbp)
+	mov -56(%rbp), %rax
+	imul $10, %rax
+	mov %rax, -56(%rbp)
+	lea -72(%rbp), %rax
+	mov 16(%rax), %rbx
+	lea .L.L.39(%rip), %rax
+	mov %rax, %rdx
+	mov $30, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	lea -660(%rbp), %rax
+	mov %rax, %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -660(%rbp), %rax
+	add $1, %rax
+	mov %rax, %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -660(%rbp), %rax
+	add $2, %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -660(%rbp), %rax
+	mov $0, %rdi
+	shl $8, %rdi
+	movzbl 2(%rax), %r11d
+	or %r11, %rdi
+	shl $8, %rdi
+	movzbl 1(%rax), %r11d
+	or %r11, %rdi
+	shl $8, %rdi
+	movzbl 0(%rax), %r11d
+	or %r11, %rdi
+	mov $0, %rax
+	call next_tri
+	mov %al, -657(%rbp)
+	shr $8, %rax
+	mov %al, -656(%rbp)
+	shr $8, %rax
+	mov %al, -655(%rbp)
+	shr $8, %rax
+	lea -657(%rbp), %rax
+	lea -660(%rbp), %rdi
+	mov 0(%rax), %r8w
+	mov %r8w, 0(%rdi)
+	mov 2(%rax), %r8b
+	mov %r8b, 2(%rdi)
+	lea -660(%rbp), %rax
+	mov $0, %rdi
+	shl $8, %rdi
+	movzbl 2(%rax), %r11d
+	or %r11, %rdi
+	shl $8, %rdi
+	movzbl 1(%rax), %r11d
+	or %r11, %rdi
+	shl $8, %rdi
+	movzbl 0(%rax), %r11d
+	or %r11, %rdi
+	mov $0, %rax
+	call sum_tri
+	movsxd %eax, %rbx
+	lea .L.L.40(%rip), %rax
+	mov %rax, %rdx
+	mov $9, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	lea -654(%rbp), %rax
+	mov %rax, %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -654(%rbp), %rax
+	add $1, %rax
+	mov %rax, %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -654(%rbp), %rax
+	add $2, %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -654(%rbp), %rax
+	mov $0, %rdi
+	shl $8, %rdi
+	movzbl 2(%rax), %r11d
+	or %r11, %rdi
+	shl $8, %rdi
+	movzbl 1(%rax), %r11d
+	or %r11, %rdi
+	shl $8, %rdi
+	movzbl 0(%rax), %r11d
+	or %r11, %rdi
+	mov $0, %rax
+	call next_tri
+	mov %al, -651(%rbp)
+	shr $8, %rax
+	mov %al, -650(%rbp)
+	shr $8, %rax
+	mov %al, -649(%rbp)
+	shr $8, %rax
+	lea -651(%rbp), %rax
+	lea -654(%rbp), %rax
+	add $1, %rax
+	movsbq (%rax), %rbx
+	lea .L.L.41(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	mov $3, %rcx
+	mov $2, %rax
+	mov %rax, %rdx
+	lea -624(%rbp), %rdi
+	mov $0, %rax
+	call make_big
+	lea -624(%rbp), %rax
+	lea -648(%rbp), %rdi
+	movdqu 0(%rax), %xmm0
+	movdqu %xmm0, 0(%rdi)
+	mov 16(%rax), %r8
+	mov %r8, 16(%rdi)
+	mov -640(%rbp), %rbx
+	mov -648(%rbp), %rax
+	add %rbx, %rax
+	mov %rax, %rbx
+	mov -632(%rbp), %rax
+	add %rbx, %rax
+	mov %rax, %rbx
+	lea .L.L.42(%rip), %rax
+	mov %rax, %rdx
+	mov $6, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	mov $3, %rcx
+	mov $2, %rax
+	mov %rax, %rdx
+	lea -576(%rbp), %rdi
+	mov $0, %rax
+	call make_big
+	lea -576(%rbp), %rax
+	lea -600(%rbp), %rdi
+	movdqu 0(%rax), %xmm0
+	movdqu %xmm0, 0(%rdi)
+	mov 16(%rax), %r8
+	mov %r8, 16(%rdi)
+	sub $32, %rsp
+	lea -600(%rbp), %rax
+	lea 0(%rsp), %rdi
+	movdqu 0(%rax), %xmm0
+	movdqu %xmm0, 0(%rdi)
+	mov 16(%rax), %r8
+	mov %r8, 16(%rdi)
+	mov $3, %rsi
+	mov $2, %rdi
+	mov $0, %rax
+	call make_pair
+	mov %rax, -552(%rbp)
+	lea -552(%rbp), %rax
+	mov %rax, %rbx
+	mov $2, %rsi
+	mov $4, %rcx
+	mov $5, %r8
+	mov $3, %rdx
+	mov $1, %rdi
+	mov %rbx, %rax
+	mov 0(%rax), %r9
+	mov $0, %rax
+	call sum_big
+	add $32, %rsp
+	mov %rax, %rbx
+	lea .L.L.43(%rip), %rax
+	mov %rax, %rdx
+	mov $26, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	mov $3, %rcx
+	mov $2, %rax
+	mov %rax, %rdx
+	lea -496(%rbp), %rdi
+	mov $0, %rax
+	call make_big
+	lea -496(%rbp), %rax
+	lea -48(%rbp), %rdi
+	movdqu 0(%rax), %xmm0
+	movdqu %xmm0, 0(%rdi)
+	mov 16(%rax), %r8
+	mov %r8, 16(%rdi)
+	mov -48(%rbp), %rax
+	imul $10, %rax
+	mov %rax, -48(%rbp)
+	mov -40(%rbp), %rax
+	imul $10, %rax
+	mov %rax, -40(%rbp)
+	mov -32(%rbp), %rax
+	imul $10, %rax
+	mov %rax, -32(%rbp)
+	lea -48(%rbp), %rax
+	lea -544(%rbp), %rdi
+	movdqu 0(%rax), %xmm0
+	movdqu %xmm0, 0(%rdi)
+	mov 16(%rax), %r8
+	mov %r8, 16(%rdi)
+	mov -536(%rbp), %rbx
+	mov -544(%rbp), %rax
+	add %rbx, %rax
+	mov %rax, %rbx
+	mov -528(%rbp), %rax
+	add %rbx, %rax
+	mov %rax, %rbx
+	lea .L.L.44(%rip), %rax
+	mov %rax, %rdx
+	mov $60, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	mov $3, %rcx
+	mov $2, %rax
+	mov %rax, %rdx
+	lea -424(%rbp), %rdi
+	mov $0, %rax
+	call make_big
+	lea -424(%rbp), %rax
+	lea -472(%rbp), %rdi
+	movdqu 0(%rax), %xmm0
+	movdqu %xmm0, 0(%rdi)
+	mov 16(%rax), %r8
+	mov %r8, 16(%rdi)
+	lea -472(%rbp), %rax
+	lea -24(%rbp), %rdi
+	movdqu 0(%rax), %xmm0
+	movdqu %xmm0, 0(%rdi)
+	mov 16(%rax), %r8
+	mov %r8, 16(%rdi)
+	mov -24(%rbp), %rax
+	imul $10, %rax
+	mov %rax, -24(%rbp)
+	mov -16(%rbp), %rax
+	imul $10, %rax
+	mov %rax, -16(%rbp)
+	mov -8(%rbp), %rax
+	imul $10, %rax
+	mov %rax, -8(%rbp)
+	lea -24(%rbp), %rax
+	lea -448(%rbp), %rdi
+	movdqu 0(%rax), %xmm0
+	movdqu %xmm0, 0(%rdi)
+	mov 16(%rax), %r8
+	mov %r8, 16(%rdi)
+	mov -456(%rbp), %rbx
+	lea .L.L.45(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $0, %rsi
+	mov $10000000, %rdi
+	mov $0, %rax
+	call count_down
+	movsxd %eax, %rbx
+	lea .L.L.46(%rip), %rax
+	mov %rax, %rdx
+	mov $10000000, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $10000000, %rdi
+	mov $0, %rax
+	call is_even
+	movsxd %eax, %rbx
+	lea .L.L.47(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $10000000, %rdi
+	mov $0, %rax
+	call is_odd
+	movsxd %eax, %rbx
+	lea .L.L.48(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $2, %rdi
+	mov $0, %rax
+	call sum_leaf
+	movsxd %eax, %rbx
+	lea .L.L.49(%rip), %rax
+	mov %rax, %rdx
+	mov $90, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	lea -376(%rbp), %rax
+	mov %rax, %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov $2, %rdi
+	mov $0, %rax
+	call sum_leaf
+	movsxd %eax, %rbx
+	lea .L.L.50(%rip), %rax
+	mov %rax, %rdx
+	mov $90, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	lea .L.L.51(%rip), %rax
+	mov %rax, %rdi
+	mov $0, %rax
+	call printf
+	movsxd %eax, %rax
+	mov $0, %rax
+.L.return.main:
+	mov -888(%rbp), %rbx
+	mov -896(%rbp), %r13
+	mov -904(%rbp), %r14
+	mov -912(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
+.text
+	.globl sum_leaf
+sum_leaf:
+	mov %rbx, -56(%rsp)
+	mov %r13, -64(%rsp)
+	mov %r14, -72(%rsp)
+	mov %r15, -80(%rsp)
+	movsxd %edi, %r13
+.L.body.sum_leaf:
+	mov $0, %rax
+	movsxd %eax, %r15
+	jmp .L.cond.1
+.L.begin.1:
+	lea -40(%rsp), %rax
+	lea (%rax,%r15,4), %rax
+	mov %rax, %rbx
+	mov %r15, %rax
+	imul %r13d, %eax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov %r15, %rax
+	add $1, %eax
+	movsxd %eax, %r15
+.L.cond.1:
+	cmp $10, %r15d
+	jl .L.begin.1
+	mov $0, %rax
+	movsxd %eax, %r14
+	mov $0, %rax
+	movsxd %eax, %r15
+	jmp .L.cond.2
+.L.begin.2:
+	lea -40(%rsp), %rax
+	movsxd (%rax,%r15,4), %rax
+	add %r14d, %eax
+	movsxd %eax, %r14
+	mov %r15, %rax
+	add $1, %eax
+	movsxd %eax, %r15
+.L.cond.2:
+	cmp $10, %r15d
+	jl .L.begin.2
+	mov %r14, %rax
+.L.return.sum_leaf:
+	mov -56(%rsp), %rbx
+	mov -64(%rsp), %r13
+	mov -72(%rsp), %r14
+	mov -80(%rsp), %r15
+	ret
+.text
+	.globl is_odd
+is_odd:
+	push %rbp
+	mov %rsp, %rbp
+	sub $16, %rsp
+	mov %r15, -8(%rbp)
+	movsxd %edi, %r15
+.L.body.is_odd:
+	cmp $0, %r15d
+	jne .L.else.3
+	mov $0, %rax
+	jmp .L.return.is_odd
+.L.else.3:
+.L.end.3:
+	mov %r15, %rax
+	sub $1, %eax
+	mov %rax, %rdi
+	mov -8(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	mov $0, %rax
+	jmp is_even
+.L.return.is_odd:
+	mov -8(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
+.text
+	.globl is_even
+is_even:
+	push %rbp
+	mov %rsp, %rbp
+	sub $16, %rsp
+	mov %r15, -8(%rbp)
+	movsxd %edi, %r15
+.L.body.is_even:
+	cmp $0, %r15d
+	jne .L.else.4
+	mov $1, %rax
+	jmp .L.return.is_even
+.L.else.4:
+.L.end.4:
+	mov %r15, %rax
+	sub $1, %eax
+	mov %rax, %rdi
+	mov -8(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	mov $0, %rax
+	jmp is_odd
+.L.return.is_even:
+	mov -8(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
+.text
+	.globl count_down
+count_down:
+	mov %r14, -8(%rsp)
+	mov %r15, -16(%rsp)
+	movsxd %edi, %r15
+	movsxd %esi, %r14
+.L.body.count_down:
+	cmp $0, %r15d
+	jne .L.else.5
+	mov %r14, %rax
+	jmp .L.return.count_down
+.L.else.5:
+.L.end.5:
+	mov %r14, %rax
+	add $1, %eax
+	mov %rax, %rsi
+	mov %r15, %rax
+	sub $1, %eax
+	mov %rax, %rdi
+	movsxd %edi, %r15
+	movsxd %esi, %r14
+	jmp .L.body.count_down
+.L.return.count_down:
+	mov -8(%rsp), %r14
+	mov -16(%rsp), %r15
+	ret
+.text
+	.globl bump
+bump:
+.L.body.bump:
+	movsxd bumped(%rip), %rax
+	add $1, %eax
+	mov %eax, bumped(%rip)
+	mov $7, %rax
+.L.return.bump:
+	ret
+.text
+	.globl scale_big
+scale_big:
+	push %rbp
+	mov %rsp, %rbp
+	sub $48, %rsp
+	mov %r13, -24(%rbp)
+	mov %r14, -32(%rbp)
+	mov %r15, -40(%rbp)
+	mov %rdi, %r14
+	movsxd %esi, %r13
+	mov %edx, -4(%rbp)
+	mov %ecx, -8(%rbp)
+	mov %r8d, -12(%rbp)
+	mov %r9d, -16(%rbp)
+	movsxd 48(%rbp), %rax
+	movsxd %eax, %r15
+.L.body.scale_big:
+	mov 24(%rbp), %rax
+	imul %r15, %rax
+	mov %rax, 24(%rbp)
+	mov 32(%rbp), %rax
+	imul %r15, %rax
+	mov %rax, 32(%rbp)
+	mov 40(%rbp), %rax
+	imul %r15, %rax
+	mov %rax, 40(%rbp)
+	lea 24(%rbp), %rax
+	mov %r14, %rdi
+	movdqu 0(%rax), %xmm0
+	movdqu %xmm0, 0(%rdi)
+	mov 16(%rax), %r8
+	mov %r8, 16(%rdi)
+	mov %r14, %rax
+.L.return.scale_big:
+	mov -24(%rbp), %r13
+	mov -32(%rbp), %r14
+	mov -40(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
+.text
+	.globl next_tri
+next_tri:
+	mov %rbx, -24(%rsp)
+	mov %dil, -3(%rsp)
+	shr $8, %rdi
+	mov %dil, -2(%rsp)
+	shr $8, %rdi
+	mov %dil, -1(%rsp)
+	shr $8, %rdi
+.L.body.next_tri:
+	lea -3(%rsp), %rax
+	mov %rax, %rbx
+	lea -3(%rsp), %rax
+	movsbq (%rax), %rax
+	add $1, %eax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -3(%rsp), %rax
+	add $1, %rax
+	mov %rax, %rbx
+	lea -3(%rsp), %rax
+	add $1, %rax
+	movsbq (%rax), %rax
+	add $1, %eax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -3(%rsp), %rax
+	add $2, %rax
+	mov %rax, %rbx
+	lea -3(%rsp), %rax
+	add $2, %rax
+	movsbq (%rax), %rax
+	add $1, %eax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -3(%rsp), %rax
+	mov %rax, %rsi
+	mov $0, %rax
+	shl $8, %rax
+	movzbl 2(%rsi), %r11d
+	or %r11, %rax
+	shl $8, %rax
+	movzbl 1(%rsi), %r11d
+	or %r11, %rax
+	shl $8, %rax
+	movzbl 0(%rsi), %r11d
+	or %r11, %rax
+.L.return.next_tri:
+	mov -24(%rsp), %rbx
+	ret
+.text
+	.globl swap_pair
+swap_pair:
+	mov %rdi, -16(%rsp)
+.L.body.swap_pair:
+	movsxd -12(%rsp), %rax
+	mov %al, -8(%rsp)
+	movsbq -16(%rsp), %rax
+	mov %eax, -4(%rsp)
+	lea -8(%rsp), %rax
+	mov %rax, %rsi
+	mov 0(%rsi), %rax
+.L.return.swap_pair:
+	ret
+.text
+	.globl add8
+add8:
+	push %rbp
+	mov %rsp, %rbp
+	sub $48, %rsp
+	mov %rbx, -24(%rbp)
+	mov %r13, -32(%rbp)
+	mov %r14, -40(%rbp)
+	mov %r15, -48(%rbp)
+	movsxd %edi, %r15
+	movsxd %esi, %r14
+	movsxd %edx, %r13
+	mov %ecx, -4(%rbp)
+	mov %r8d, -8(%rbp)
+	mov %r9d, -12(%rbp)
+.L.body.add8:
+	movsbq 16(%rbp), %rbx
+	mov %r15, %rax
+	sub %r14d, %eax
+	add %r13d, %eax
+	sub -4(%rbp), %eax
+	add -8(%rbp), %eax
+	sub -12(%rbp), %eax
+	add %ebx, %eax
+	sub 24(%rbp), %eax
+.L.return.add8:
+	mov -24(%rbp), %rbx
+	mov -32(%rbp), %r13
+	mov -40(%rbp), %r14
+	mov -48(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
+.text
+	.globl ret_short
+ret_short:
+	mov %r15, -8(%rsp)
+	movswq %di, %r15
+.L.body.ret_short:
+	mov %r15, %rax
+	add $1, %eax
+.L.return.ret_short:
+	mov -8(%rsp), %r15
+	ret
+.text
+	.globl ret_char
+ret_char:
+	mov %r15, -8(%rsp)
+	movsbq %dil, %r15
+.L.body.ret_char:
+	mov %r15, %rax
+.L.return.ret_char:
+	mov -8(%rsp), %r15
+	ret
+.text
+	.globl set_to
+set_to:
+	mov %rbx, -8(%rsp)
+	mov %r14, -16(%rsp)
+	mov %r15, -24(%rsp)
+	mov %rdi, %r15
+	movsxd %esi, %r14
+.L.body.set_to:
+	lea (%r15), %rax
+	mov %rax, %rbx
+	mov %r14, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+.L.return.set_to:
+	mov -8(%rsp), %rbx
+	mov -16(%rsp), %r14
+	mov -24(%rsp), %r15
+	ret
+.text
+	.globl sq_plus
+sq_plus:
+	mov %r14, -8(%rsp)
+	mov %r15, -16(%rsp)
+	movsxd %edi, %r14
+.L.body.sq_plus:
+	mov %r14, %rax
+	imul %r14d, %eax
+	movsxd %eax, %r15
+	mov %r15, %rax
+	add $1, %eax
+.L.return.sq_plus:
+	mov -8(%rsp), %r14
+	mov -16(%rsp), %r15
+	ret
+.text
+	.globl sub_short
+sub_short:
+	mov %r13, -8(%rsp)
+	mov %r14, -16(%rsp)
+	mov %r15, -24(%rsp)
+	movswq %di, %r15
+	movswq %si, %r14
+	movswq %dx, %r13
+.L.body.sub_short:
+	mov %r15, %rax
+	sub %r14d, %eax
+	sub %r13d, %eax
+.L.return.sub_short:
+	mov -8(%rsp), %r13
+	mov -16(%rsp), %r14
+	mov -24(%rsp), %r15
+	ret
+.text
+	.globl sub_long
+sub_long:
+	mov %r13, -8(%rsp)
+	mov %r14, -16(%rsp)
+	mov %r15, -24(%rsp)
+	mov %rdi, %r15
+	mov %rsi, %r14
+	mov %rdx, %r13
+.L.body.sub_long:
+	mov %r15, %rax
+	sub %r14, %rax
+	sub %r13, %rax
+.L.return.sub_long:
+	mov -8(%rsp), %r13
+	mov -16(%rsp), %r14
+	mov -24(%rsp), %r15
+	ret
+.text
+	.globl fib
+fib:
+	push %rbp
+	mov %rsp, %rbp
+	sub $16, %rsp
+	mov %rbx, -8(%rbp)
+	mov %r15, -16(%rbp)
+	movsxd %edi, %r15
+.L.body.fib:
+	cmp $1, %r15d
+	jg .L.else.6
+	mov $1, %rax
+	jmp .L.return.fib
+.L.else.6:
+.L.end.6:
+	mov %r15, %rax
+	sub $2, %eax
+	mov %rax, %rdi
+	mov $0, %rax
+	call fib
+	movsxd %eax, %rbx
+	mov %r15, %rax
+	sub $1, %eax
+	mov %rax, %rdi
+	mov $0, %rax
+	call fib
+	movsxd %eax, %rax
+	add %ebx, %eax
+.L.return.fib:
+	mov -8(%rbp), %rbx
+	mov -16(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
+.text
+	.globl sub_char
+sub_char:
+	mov %r13, -8(%rsp)
+	mov %r14, -16(%rsp)
+	mov %r15, -24(%rsp)
+	movsbq %dil, %r15
+	movsbq %sil, %r14
+	movsbq %dl, %r13
+.L.body.sub_char:
+	mov %r15, %rax
+	sub %r14d, %eax
+	sub %r13d, %eax
+.L.return.sub_char:
+	mov -8(%rsp), %r13
+	mov -16(%rsp), %r14
+	mov -24(%rsp), %r15
+	ret
+.text
+	.globl addx
+addx:
+	mov %r14, -8(%rsp)
+	mov %r15, -16(%rsp)
+	mov %rdi, %r15
+	movsxd %esi, %r14
+.L.body.addx:
+	movsxd (%r15), %rax
+	add %r14d, %eax
+.L.return.addx:
+	mov -8(%rsp), %r14
+	mov -16(%rsp), %r15
+	ret
+.text
+	.globl add6
+add6:
+	mov %r13, -24(%rsp)
+	mov %r14, -32(%rsp)
+	mov %r15, -40(%rsp)
+	movsxd %edi, %r15
+	movsxd %esi, %r14
+	movsxd %edx, %r13
+	mov %ecx, -4(%rsp)
+	mov %r8d, -8(%rsp)
+	mov %r9d, -12(%rsp)
+.L.body.add6:
+	mov %r15, %rax
+	add %r14d, %eax
+	add %r13d, %eax
+	add -4(%rsp), %eax
+	add -8(%rsp), %eax
+	add -12(%rsp), %eax
+.L.return.add6:
+	mov -24(%rsp), %r13
+	mov -32(%rsp), %r14
+	mov -40(%rsp), %r15
+	ret
+.text
+	.globl sub2
+sub2:
+	mov %r14, -8(%rsp)
+	mov %r15, -16(%rsp)
+	movsxd %edi, %r15
+	movsxd %esi, %r14
+.L.body.sub2:
+	mov %r15, %rax
+	sub %r14d, %eax
+.L.return.sub2:
+	mov -8(%rsp), %r14
+	mov -16(%rsp), %r15
+	ret
+.text
+	.globl add2
+add2:
+	mov %r14, -8(%rsp)
+	mov %r15, -16(%rsp)
+	movsxd %edi, %r15
+	movsxd %esi, %r14
+.L.body.add2:
+	mov %r15, %rax
+	add %r14d, %eax
+.L.return.add2:
+	mov -8(%rsp), %r14
+	mov -16(%rsp), %r15
+	ret
+.text
+	.globl ret3
+ret3:
+.L.body.ret3:
+	mov $3, %rax
+.L.return.ret3:
+	ret
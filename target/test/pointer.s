@@ -0,0 +1,2668 @@
+.data
+	.global .L.L.38
+.L.L.38:
+	.byte 79
+	.byte 75
+	.byte 10
+	.byte 0
+.data
+	.global .L.L.37
+.L.L.37:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 104
+	.byte 111
+	.byte 114
+	.byte 116
+	.byte 32
+	.byte 99
+	.byte 61
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 40
+	.byte 99
+	.byte 42
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 41
+	.byte 47
+	.byte 55
+	.byte 43
+	.byte 40
+	.byte 99
+	.byte 42
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 48
+	.byte 41
+	.byte 47
+	.byte 57
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.36
+.L.L.36:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 99
+	.byte 61
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 40
+	.byte 99
+	.byte 43
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 41
+	.byte 42
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 40
+	.byte 99
+	.byte 43
+	.byte 49
+	.byte 48
+	.byte 48
+	.byte 41
+	.byte 42
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 43
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.35
+.L.L.35:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 105
+	.byte 42
+	.byte 106
+	.byte 43
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 105
+	.byte 42
+	.byte 106
+	.byte 43
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 43
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.34
+.L.L.34:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 97
+	.byte 91
+	.byte 105
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 43
+	.byte 97
+	.byte 91
+	.byte 105
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.33
+.L.L.33:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 105
+	.byte 93
+	.byte 61
+	.byte 97
+	.byte 91
+	.byte 105
+	.byte 93
+	.byte 43
+	.byte 97
+	.byte 91
+	.byte 105
+	.byte 93
+	.byte 42
+	.byte 97
+	.byte 91
+	.byte 105
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.32
+.L.L.32:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 61
+	.byte 120
+	.byte 43
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 45
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 112
+	.byte 91
+	.byte 105
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.31
+.L.L.31:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 105
+	.byte 93
+	.byte 43
+	.byte 120
+	.byte 91
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.30
+.L.L.30:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 91
+	.byte 53
+	.byte 93
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.29
+.L.L.29:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.28
+.L.L.28:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.27
+.L.L.27:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.26
+.L.L.26:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.25
+.L.L.25:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.24
+.L.L.24:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 50
+	.byte 91
+	.byte 120
+	.byte 93
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 50
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.23
+.L.L.23:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 50
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.22
+.L.L.22:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 50
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.21
+.L.L.21:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.20
+.L.L.20:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.19
+.L.L.19:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 121
+	.byte 43
+	.byte 53
+	.byte 41
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 43
+	.byte 50
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.18
+.L.L.18:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 121
+	.byte 43
+	.byte 52
+	.byte 41
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.17
+.L.L.17:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 121
+	.byte 43
+	.byte 51
+	.byte 41
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.16
+.L.L.16:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 121
+	.byte 43
+	.byte 50
+	.byte 41
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 42
+	.byte 120
+	.byte 43
+	.byte 50
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.15
+.L.L.15:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 121
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 42
+	.byte 120
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.14
+.L.L.14:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 42
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.13
+.L.L.13:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 50
+	.byte 41
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 50
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.12
+.L.L.12:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 50
+	.byte 41
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.11
+.L.L.11:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 120
+	.byte 43
+	.byte 50
+	.byte 41
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.10
+.L.L.10:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 38
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.9
+.L.L.9:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 44
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 43
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.8
+.L.L.8:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 61
+	.byte 38
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.7
+.L.L.7:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 38
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.6
+.L.L.6:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 38
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 45
+	.byte 49
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.5
+.L.L.5:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 40
+	.byte 38
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.4
+.L.L.4:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 44
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 43
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.3
+.L.L.3:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 40
+	.byte 38
+	.byte 120
+	.byte 43
+	.byte 50
+	.byte 41
+	.byte 45
+	.byte 38
+	.byte 120
+	.byte 43
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.2
+.L.L.2:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 38
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.1
+.L.L.1:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 61
+	.byte 38
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 42
+	.byte 122
+	.byte 61
+	.byte 38
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 42
+	.byte 122
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.0
+.L.L.0:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 38
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.text
+	.globl main
+main:
+	push %rbp
+	mov %rsp, %rbp
+	sub $832, %rsp
+	mov %rbx, -792(%rbp)
+	mov %r12, -800(%rbp)
+	mov %r13, -808(%rbp)
+	mov %r14, -816(%rbp)
+	mov %r15, -824(%rbp)
+.L.body.main:
+	mov $3, %rax
+	mov %eax, -784(%rbp)
+	lea -784(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.0(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -780(%rbp)
+	lea -780(%rbp), %rax
+	mov %rax, -776(%rbp)
+	lea -776(%rbp), %rax
+	mov %rax, -768(%rbp)
+	mov -768(%rbp), %rax
+	mov (%rax), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.1(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -756(%rbp)
+	lea -756(%rbp), %rax
+	mov %rax, -752(%rbp)
+	mov -752(%rbp), %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	movsxd -756(%rbp), %rsi
+	lea .L.L.2(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -744(%rbp)
+	lea -744(%rbp), %rax
+	mov %rax, %rbx
+	lea -744(%rbp), %rax
+	add $8, %rax
+	sub %rbx, %rax
+	mov %eax, %edi
+	sar $31, %edi
+	shr $30, %edi
+	add %edi, %eax
+	sar $2, %eax
+	add $3, %eax
+	mov %rax, %rsi
+	lea .L.L.3(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -740(%rbp)
+	mov $5, %rax
+	mov %eax, -736(%rbp)
+	movsxd -740(%rbp), %rax
+	add -736(%rbp), %eax
+	mov %rax, %rsi
+	lea .L.L.4(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	lea -732(%rbp), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -732(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -732(%rbp), %rax
+	add $4, %rax
+	movsxd (%rax), %rsi
+	lea .L.L.5(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	lea -724(%rbp), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -724(%rbp), %rax
+	add $4, %rax
+	mov %rax, -80(%rbp)
+	mov -80(%rbp), %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -80(%rbp), %rax
+	sub $4, %rax
+	movsxd (%rax), %rsi
+	lea .L.L.6(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea -716(%rbp), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -716(%rbp), %rax
+	add $4, %rax
+	mov %rax, -72(%rbp)
+	mov -72(%rbp), %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -716(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $7, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -72(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.7(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -708(%rbp)
+	lea -708(%rbp), %rax
+	mov %rax, -704(%rbp)
+	mov $4, %rax
+	mov %eax, -708(%rbp)
+	mov -704(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.8(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -696(%rbp)
+	mov $5, %rax
+	mov %eax, -692(%rbp)
+	movsxd -696(%rbp), %rax
+	add -692(%rbp), %eax
+	mov %rax, %rsi
+	lea .L.L.9(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	lea -688(%rbp), %rax
+	mov %rax, -680(%rbp)
+	mov -680(%rbp), %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -688(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.10(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea -668(%rbp), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -668(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -668(%rbp), %rax
+	add $8, %rax
+	mov %rax, %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -668(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.11(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea -656(%rbp), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -656(%rbp), %rax
+	add $4, %rax
+	mov %rax, -64(%rbp)
+	mov -64(%rbp), %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -656(%rbp), %rax
+	add $8, %rax
+	mov %rax, %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -64(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.12(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	lea -644(%rbp), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -644(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -644(%rbp), %rax
+	add $8, %rax
+	mov %rax, -56(%rbp)
+	mov -56(%rbp), %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -56(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.13(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	lea -632(%rbp), %rax
+	mov %rax, -608(%rbp)
+	mov -608(%rbp), %rbx
+	mov $0, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -632(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.14(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	lea -600(%rbp), %rax
+	mov %rax, -576(%rbp)
+	mov -576(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -600(%rbp), %rax
+	add $4, %rax
+	movsxd (%rax), %rsi
+	lea .L.L.15(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	lea -568(%rbp), %rax
+	mov %rax, -544(%rbp)
+	mov -544(%rbp), %rax
+	add $8, %rax
+	mov %rax, %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -568(%rbp), %rax
+	add $8, %rax
+	movsxd (%rax), %rsi
+	lea .L.L.16(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	lea -536(%rbp), %rax
+	mov %rax, -512(%rbp)
+	mov -512(%rbp), %rax
+	add $12, %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -536(%rbp), %rax
+	add $12, %rax
+	movsxd (%rax), %rsi
+	lea .L.L.17(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea -504(%rbp), %rax
+	mov %rax, -480(%rbp)
+	mov -480(%rbp), %rax
+	add $16, %rax
+	mov %rax, %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -504(%rbp), %rax
+	add $12, %rax
+	add $4, %rax
+	movsxd (%rax), %rsi
+	lea .L.L.18(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	lea -472(%rbp), %rax
+	mov %rax, -448(%rbp)
+	mov -448(%rbp), %rax
+	add $20, %rax
+	mov %rax, %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -472(%rbp), %rax
+	add $12, %rax
+	add $8, %rax
+	movsxd (%rax), %rsi
+	lea .L.L.19(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	lea -436(%rbp), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -436(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -436(%rbp), %rax
+	add $8, %rax
+	mov %rax, %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -436(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.20(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea -424(%rbp), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -424(%rbp), %rax
+	add $4, %rax
+	mov %rax, -48(%rbp)
+	mov -48(%rbp), %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -424(%rbp), %rax
+	add $8, %rax
+	mov %rax, %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -48(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.21(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	lea -412(%rbp), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -412(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -412(%rbp), %rax
+	add $8, %rax
+	mov %rax, -40(%rbp)
+	mov -40(%rbp), %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -40(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.22(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	lea -400(%rbp), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -400(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -400(%rbp), %rax
+	add $8, %rax
+	mov %rax, -32(%rbp)
+	mov -32(%rbp), %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -32(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.23(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	lea -388(%rbp), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -388(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -388(%rbp), %rax
+	add $8, %rax
+	mov %rax, -24(%rbp)
+	mov -24(%rbp), %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -24(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.24(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	lea -376(%rbp), %rax
+	mov %rax, -352(%rbp)
+	mov -352(%rbp), %rbx
+	mov $0, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -376(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.25(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	lea -344(%rbp), %rax
+	mov %rax, -320(%rbp)
+	mov -320(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -344(%rbp), %rax
+	add $4, %rax
+	movsxd (%rax), %rsi
+	lea .L.L.26(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	lea -312(%rbp), %rax
+	mov %rax, -288(%rbp)
+	mov -288(%rbp), %rax
+	add $8, %rax
+	mov %rax, %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -312(%rbp), %rax
+	add $8, %rax
+	movsxd (%rax), %rsi
+	lea .L.L.27(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	lea -280(%rbp), %rax
+	mov %rax, -256(%rbp)
+	mov -256(%rbp), %rax
+	add $12, %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -280(%rbp), %rax
+	add $12, %rax
+	movsxd (%rax), %rsi
+	lea .L.L.28(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea -248(%rbp), %rax
+	mov %rax, -224(%rbp)
+	mov -224(%rbp), %rax
+	add $16, %rax
+	mov %rax, %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -248(%rbp), %rax
+	add $12, %rax
+	add $4, %rax
+	movsxd (%rax), %rsi
+	lea .L.L.29(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	lea -216(%rbp), %rax
+	mov %rax, -192(%rbp)
+	mov -192(%rbp), %rax
+	add $20, %rax
+	mov %rax, %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -216(%rbp), %rax
+	add $12, %rax
+	add $8, %rax
+	movsxd (%rax), %rsi
+	lea .L.L.30(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	lea -180(%rbp), %rax
+	mov %rax, %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -180(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -180(%rbp), %rax
+	add $8, %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov $1, %rax
+	mov %eax, -168(%rbp)
+	movsxd -168(%rbp), %rax
+	add $1, %eax
+	mov %rax, %rbx
+	lea -180(%rbp), %rax
+	movsxd (%rax,%rbx,4), %rbx
+	movsxd -168(%rbp), %r12
+	lea -180(%rbp), %rax
+	movsxd (%rax,%r12,4), %rax
+	add %ebx, %eax
+	mov %rax, %rsi
+	lea .L.L.31(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	lea -164(%rbp), %rax
+	add $8, %rax
+	mov %rax, -16(%rbp)
+	lea -164(%rbp), %rax
+	mov %rax, %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -164(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -16(%rbp), %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -16(%rbp), %rax
+	mov %rax, -152(%rbp)
+	mov $-1, %rax
+	mov %eax, -144(%rbp)
+	movsxd -144(%rbp), %rbx
+	mov -152(%rbp), %rax
+	movsxd (%rax,%rbx,4), %rsi
+	lea .L.L.32(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	lea -140(%rbp), %rax
+	add $4, %rax
+	mov %rax, -8(%rbp)
+	lea -140(%rbp), %rax
+	mov %rax, %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -8(%rbp), %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -140(%rbp), %rax
+	add $8, %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov $1, %rax
+	mov %eax, -128(%rbp)
+	movsxd -128(%rbp), %rbx
+	lea -140(%rbp), %rax
+	lea (%rax,%rbx,4), %rax
+	mov %rax, %r15
+	lea (%r15), %rax
+	mov %rax, %rbx
+	movsxd (%r15), %r12
+	movsxd (%r15), %rax
+	imul %r12d, %eax
+	mov %rax, %r12
+	movsxd (%r15), %rax
+	add %r12d, %eax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -8(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.33(%rip), %rax
+	mov %rax, %rdx
+	mov $6, %rdi
+	mov $0, %rax
+	call assert_
+	lea -124(%rbp), %rax
+	mov %rax, %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -124(%rbp), %rax
+	add $4, %rax
+	mov %rax, %rbx
+	mov $7, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov $0, %rax
+	movsxd %eax, %r14
+	lea -124(%rbp), %rax
+	movsxd (%rax,%r14,4), %rax
+	mov %eax, -116(%rbp)
+	mov $1, %rax
+	movsxd %eax, %r14
+	lea -124(%rbp), %rax
+	movsxd (%rax,%r14,4), %rax
+	add -116(%rbp), %eax
+	mov %rax, %rsi
+	lea .L.L.34(%rip), %rax
+	mov %rax, %rdx
+	mov $12, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rax
+	mov %eax, -112(%rbp)
+	mov $3, %rax
+	mov %eax, -108(%rbp)
+	movsxd -112(%rbp), %rax
+	imul -108(%rbp), %eax
+	add $1, %eax
+	mov %eax, -104(%rbp)
+	movsxd -112(%rbp), %rax
+	imul -108(%rbp), %eax
+	add $2, %eax
+	mov %eax, -100(%rbp)
+	movsxd -104(%rbp), %rax
+	add -100(%rbp), %eax
+	mov %rax, %rsi
+	lea .L.L.35(%rip), %rax
+	mov %rax, %rdx
+	mov $15, %rdi
+	mov $0, %rax
+	call assert_
+	mov $100, %rax
+	mov %al, -93(%rbp)
+	movsbq -93(%rbp), %rax
+	add $100, %eax
+	shl $1, %rax
+	mov %eax, -92(%rbp)
+	movsbq -93(%rbp), %rax
+	add $100, %eax
+	imul $3, %eax
+	mov %eax, -88(%rbp)
+	movsxd -92(%rbp), %rax
+	add -88(%rbp), %eax
+	mov %rax, %rsi
+	lea .L.L.36(%rip), %rax
+	mov %rax, %rdx
+	mov $1000, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1000, %rax
+	mov %ax, -82(%rbp)
+	movswq -82(%rbp), %rax
+	imul $1000, %eax
+	movsxd %eax, %r13
+	mov $9, %rbx
+	mov %r13, %rax
+	cdq
+	idiv %ebx
+	mov %rax, %rbx
+	mov $7, %r12
+	mov %r13, %rax
+	cdq
+	idiv %r12d
+	add %ebx, %eax
+	mov %rax, %rsi
+	lea .L.L.37(%rip), %rax
+	mov %rax, %rdx
+	mov $253968, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.38(%rip), %rax
+	mov %rax, %rdi
+	mov $0, %rax
+	call printf
+	movsxd %eax, %rax
+	mov $0, %rax
+.L.return.main:
+	mov -792(%rbp), %rbx
+	mov -800(%rbp), %r12
+	mov -808(%rbp), %r13
+	mov -816(%rbp), %r14
+	mov -824(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
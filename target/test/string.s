@@ -0,0 +1,848 @@
+.data
+	.global .L.L.43
+.L.L.43:
+	.byte 79
+	.byte 75
+	.byte 10
+	.byte 0
+.data
+	.global .L.L.42
+.L.L.42:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 100
+	.byte 101
+	.byte 110
+	.byte 116
+	.byte 105
+	.byte 102
+	.byte 105
+	.byte 101
+	.byte 114
+	.byte 95
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 101
+	.byte 114
+	.byte 95
+	.byte 116
+	.byte 104
+	.byte 97
+	.byte 110
+	.byte 95
+	.byte 116
+	.byte 104
+	.byte 105
+	.byte 114
+	.byte 116
+	.byte 121
+	.byte 95
+	.byte 116
+	.byte 119
+	.byte 111
+	.byte 95
+	.byte 98
+	.byte 121
+	.byte 116
+	.byte 101
+	.byte 115
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 100
+	.byte 101
+	.byte 110
+	.byte 116
+	.byte 105
+	.byte 102
+	.byte 105
+	.byte 101
+	.byte 114
+	.byte 95
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 101
+	.byte 114
+	.byte 95
+	.byte 116
+	.byte 104
+	.byte 97
+	.byte 110
+	.byte 95
+	.byte 116
+	.byte 104
+	.byte 105
+	.byte 114
+	.byte 116
+	.byte 121
+	.byte 95
+	.byte 116
+	.byte 119
+	.byte 111
+	.byte 95
+	.byte 98
+	.byte 121
+	.byte 116
+	.byte 101
+	.byte 115
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.41
+.L.L.41:
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 34
+	.byte 97
+	.byte 110
+	.byte 32
+	.byte 101
+	.byte 115
+	.byte 99
+	.byte 97
+	.byte 112
+	.byte 101
+	.byte 100
+	.byte 32
+	.byte 92
+	.byte 34
+	.byte 32
+	.byte 113
+	.byte 117
+	.byte 111
+	.byte 116
+	.byte 101
+	.byte 32
+	.byte 112
+	.byte 97
+	.byte 115
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 104
+	.byte 101
+	.byte 32
+	.byte 102
+	.byte 105
+	.byte 114
+	.byte 115
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 104
+	.byte 105
+	.byte 114
+	.byte 116
+	.byte 121
+	.byte 45
+	.byte 116
+	.byte 119
+	.byte 111
+	.byte 32
+	.byte 98
+	.byte 121
+	.byte 116
+	.byte 101
+	.byte 115
+	.byte 34
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.40
+.L.L.40:
+	.byte 97
+	.byte 110
+	.byte 32
+	.byte 101
+	.byte 115
+	.byte 99
+	.byte 97
+	.byte 112
+	.byte 101
+	.byte 100
+	.byte 32
+	.byte 34
+	.byte 32
+	.byte 113
+	.byte 117
+	.byte 111
+	.byte 116
+	.byte 101
+	.byte 32
+	.byte 112
+	.byte 97
+	.byte 115
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 104
+	.byte 101
+	.byte 32
+	.byte 102
+	.byte 105
+	.byte 114
+	.byte 115
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 104
+	.byte 105
+	.byte 114
+	.byte 116
+	.byte 121
+	.byte 45
+	.byte 116
+	.byte 119
+	.byte 111
+	.byte 32
+	.byte 98
+	.byte 121
+	.byte 116
+	.byte 101
+	.byte 115
+	.byte 0
+.data
+	.global .L.L.39
+.L.L.39:
+	.byte 34
+	.byte 97
+	.byte 32
+	.byte 113
+	.byte 117
+	.byte 105
+	.byte 116
+	.byte 101
+	.byte 32
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 105
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 119
+	.byte 105
+	.byte 116
+	.byte 104
+	.byte 32
+	.byte 97
+	.byte 32
+	.byte 92
+	.byte 92
+	.byte 32
+	.byte 98
+	.byte 97
+	.byte 99
+	.byte 107
+	.byte 115
+	.byte 108
+	.byte 97
+	.byte 115
+	.byte 104
+	.byte 34
+	.byte 91
+	.byte 50
+	.byte 55
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.38
+.L.L.38:
+	.byte 97
+	.byte 32
+	.byte 113
+	.byte 117
+	.byte 105
+	.byte 116
+	.byte 101
+	.byte 32
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 105
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 119
+	.byte 105
+	.byte 116
+	.byte 104
+	.byte 32
+	.byte 97
+	.byte 32
+	.byte 92
+	.byte 32
+	.byte 98
+	.byte 97
+	.byte 99
+	.byte 107
+	.byte 115
+	.byte 108
+	.byte 97
+	.byte 115
+	.byte 104
+	.byte 0
+.data
+	.global .L.L.37
+.L.L.37:
+	.byte 34
+	.byte 92
+	.byte 34
+	.byte 34
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.36
+.L.L.36:
+	.byte 34
+	.byte 0
+.data
+	.global .L.L.35
+.L.L.35:
+	.byte 34
+	.byte 92
+	.byte 97
+	.byte 120
+	.byte 92
+	.byte 110
+	.byte 121
+	.byte 34
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.34
+.L.L.34:
+	.byte 7
+	.byte 120
+	.byte 10
+	.byte 121
+	.byte 0
+.data
+	.global .L.L.33
+.L.L.33:
+	.byte 34
+	.byte 92
+	.byte 97
+	.byte 120
+	.byte 92
+	.byte 110
+	.byte 121
+	.byte 34
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.32
+.L.L.32:
+	.byte 7
+	.byte 120
+	.byte 10
+	.byte 121
+	.byte 0
+.data
+	.global .L.L.31
+.L.L.31:
+	.byte 34
+	.byte 92
+	.byte 97
+	.byte 120
+	.byte 92
+	.byte 110
+	.byte 121
+	.byte 34
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.30
+.L.L.30:
+	.byte 7
+	.byte 120
+	.byte 10
+	.byte 121
+	.byte 0
+.data
+	.global .L.L.29
+.L.L.29:
+	.byte 34
+	.byte 92
+	.byte 97
+	.byte 120
+	.byte 92
+	.byte 110
+	.byte 121
+	.byte 34
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.28
+.L.L.28:
+	.byte 7
+	.byte 120
+	.byte 10
+	.byte 121
+	.byte 0
+.data
+	.global .L.L.27
+.L.L.27:
+	.byte 34
+	.byte 92
+	.byte 101
+	.byte 34
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.26
+.L.L.26:
+	.byte 27
+	.byte 0
+.data
+	.global .L.L.25
+.L.L.25:
+	.byte 34
+	.byte 92
+	.byte 114
+	.byte 34
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.24
+.L.L.24:
+	.byte 13
+	.byte 0
+.data
+	.global .L.L.23
+.L.L.23:
+	.byte 34
+	.byte 92
+	.byte 102
+	.byte 34
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.22
+.L.L.22:
+	.byte 12
+	.byte 0
+.data
+	.global .L.L.21
+.L.L.21:
+	.byte 34
+	.byte 92
+	.byte 118
+	.byte 34
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.20
+.L.L.20:
+	.byte 11
+	.byte 0
+.data
+	.global .L.L.19
+.L.L.19:
+	.byte 34
+	.byte 92
+	.byte 110
+	.byte 34
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.18
+.L.L.18:
+	.byte 10
+	.byte 0
+.data
+	.global .L.L.17
+.L.L.17:
+	.byte 34
+	.byte 92
+	.byte 116
+	.byte 34
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.16
+.L.L.16:
+	.byte 9
+	.byte 0
+.data
+	.global .L.L.15
+.L.L.15:
+	.byte 34
+	.byte 92
+	.byte 98
+	.byte 34
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.14
+.L.L.14:
+	.byte 8
+	.byte 0
+.data
+	.global .L.L.13
+.L.L.13:
+	.byte 34
+	.byte 92
+	.byte 97
+	.byte 34
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.12
+.L.L.12:
+	.byte 7
+	.byte 0
+.data
+	.global .L.L.11
+.L.L.11:
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 34
+	.byte 97
+	.byte 98
+	.byte 99
+	.byte 34
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.10
+.L.L.10:
+	.byte 97
+	.byte 98
+	.byte 99
+	.byte 0
+.data
+	.global .L.L.9
+.L.L.9:
+	.byte 34
+	.byte 97
+	.byte 98
+	.byte 99
+	.byte 34
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.8
+.L.L.8:
+	.byte 97
+	.byte 98
+	.byte 99
+	.byte 0
+.data
+	.global .L.L.7
+.L.L.7:
+	.byte 34
+	.byte 97
+	.byte 98
+	.byte 99
+	.byte 34
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.6
+.L.L.6:
+	.byte 97
+	.byte 98
+	.byte 99
+	.byte 0
+.data
+	.global .L.L.5
+.L.L.5:
+	.byte 34
+	.byte 97
+	.byte 98
+	.byte 99
+	.byte 34
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.4
+.L.L.4:
+	.byte 97
+	.byte 98
+	.byte 99
+	.byte 0
+.data
+	.global .L.L.3
+.L.L.3:
+	.byte 34
+	.byte 97
+	.byte 98
+	.byte 99
+	.byte 34
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 0
+.data
+	.global .L.L.2
+.L.L.2:
+	.byte 97
+	.byte 98
+	.byte 99
+	.byte 0
+.data
+	.global .L.L.1
+.L.L.1:
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 34
+	.byte 34
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.0
+.L.L.0:
+	.byte 0
+.text
+	.globl main
+main:
+	push %rbp
+	mov %rsp, %rbp
+	sub $16, %rsp
+	mov %r15, -8(%rbp)
+.L.body.main:
+	mov $1, %rsi
+	lea .L.L.1(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.2(%rip), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.3(%rip), %rax
+	mov %rax, %rdx
+	mov $97, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.4(%rip), %rax
+	add $1, %rax
+	movsbq (%rax), %rsi
+	lea .L.L.5(%rip), %rax
+	mov %rax, %rdx
+	mov $98, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.6(%rip), %rax
+	add $2, %rax
+	movsbq (%rax), %rsi
+	lea .L.L.7(%rip), %rax
+	mov %rax, %rdx
+	mov $99, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.8(%rip), %rax
+	add $3, %rax
+	movsbq (%rax), %rsi
+	lea .L.L.9(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.11(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.12(%rip), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.13(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.14(%rip), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.15(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.16(%rip), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.17(%rip), %rax
+	mov %rax, %rdx
+	mov $9, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.18(%rip), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.19(%rip), %rax
+	mov %rax, %rdx
+	mov $10, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.20(%rip), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.21(%rip), %rax
+	mov %rax, %rdx
+	mov $11, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.22(%rip), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.23(%rip), %rax
+	mov %rax, %rdx
+	mov $12, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.24(%rip), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.25(%rip), %rax
+	mov %rax, %rdx
+	mov $13, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.26(%rip), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.27(%rip), %rax
+	mov %rax, %rdx
+	mov $27, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.28(%rip), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.29(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.30(%rip), %rax
+	add $1, %rax
+	movsbq (%rax), %rsi
+	lea .L.L.31(%rip), %rax
+	mov %rax, %rdx
+	mov $120, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.32(%rip), %rax
+	add $2, %rax
+	movsbq (%rax), %rsi
+	lea .L.L.33(%rip), %rax
+	mov %rax, %rdx
+	mov $10, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.34(%rip), %rax
+	add $3, %rax
+	movsbq (%rax), %rsi
+	lea .L.L.35(%rip), %rax
+	mov %rax, %rdx
+	mov $121, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.36(%rip), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.37(%rip), %rax
+	mov %rax, %rdx
+	mov $34, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.38(%rip), %rax
+	add $27, %rax
+	movsbq (%rax), %rsi
+	lea .L.L.39(%rip), %rax
+	mov %rax, %rdx
+	mov $92, %rdi
+	mov $0, %rax
+	call assert_
+	mov $51, %rsi
+	lea .L.L.41(%rip), %rax
+	mov %rax, %rdx
+	mov $51, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	movsxd %eax, %r15
+	mov %r15, %rsi
+	lea .L.L.42(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.43(%rip), %rax
+	mov %rax, %rdi
+	mov $0, %rax
+	call printf
+	movsxd %eax, %rax
+	mov $0, %rax
+.L.return.main:
+	mov -8(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
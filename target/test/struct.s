@@ -0,0 +1,3490 @@
+.data
+	.global .L.L.45
+.L.L.45:
+	.byte 79
+	.byte 75
+	.byte 10
+	.byte 0
+.data
+	.global .L.L.44
+.L.L.44:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 56
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.43
+.L.L.43:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 50
+	.byte 53
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 50
+	.byte 53
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 50
+	.byte 52
+	.byte 93
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 43
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 50
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.42
+.L.L.42:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 55
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 55
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 54
+	.byte 93
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 43
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 43
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 54
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.41
+.L.L.41:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 43
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 49
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.40
+.L.L.40:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 43
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.39
+.L.L.39:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 104
+	.byte 111
+	.byte 114
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.38
+.L.L.38:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.37
+.L.L.37:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 121
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.36
+.L.L.36:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 121
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.35
+.L.L.35:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 44
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 44
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.34
+.L.L.34:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 44
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 44
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 61
+	.byte 38
+	.byte 120
+	.byte 44
+	.byte 32
+	.byte 42
+	.byte 113
+	.byte 61
+	.byte 38
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 113
+	.byte 61
+	.byte 42
+	.byte 112
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.33
+.L.L.33:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 44
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 122
+	.byte 61
+	.byte 38
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 122
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.32
+.L.L.32:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 44
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 44
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.31
+.L.L.31:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 44
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 44
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.30
+.L.L.30:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 44
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 44
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 61
+	.byte 38
+	.byte 120
+	.byte 44
+	.byte 32
+	.byte 42
+	.byte 113
+	.byte 61
+	.byte 38
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 113
+	.byte 61
+	.byte 42
+	.byte 112
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.29
+.L.L.29:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 44
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 122
+	.byte 61
+	.byte 38
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 42
+	.byte 122
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.28
+.L.L.28:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 44
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 44
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.27
+.L.L.27:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 38
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 45
+	.byte 62
+	.byte 97
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.26
+.L.L.26:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 121
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 38
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 45
+	.byte 62
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.25
+.L.L.25:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 125
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 43
+	.byte 121
+	.byte 46
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.24
+.L.L.24:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 59
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 121
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.23
+.L.L.23:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 121
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.22
+.L.L.22:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 121
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.21
+.L.L.21:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.20
+.L.L.20:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.19
+.L.L.19:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.18
+.L.L.18:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.17
+.L.L.17:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.16
+.L.L.16:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.15
+.L.L.15:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.14
+.L.L.14:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 44
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.13
+.L.L.13:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.12
+.L.L.12:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.11
+.L.L.11:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 46
+	.byte 98
+	.byte 61
+	.byte 54
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 46
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.10
+.L.L.10:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 91
+	.byte 53
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 61
+	.byte 38
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 112
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.9
+.L.L.9:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 91
+	.byte 53
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 61
+	.byte 38
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 54
+	.byte 59
+	.byte 32
+	.byte 112
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.8
+.L.L.8:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 112
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 46
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.7
+.L.L.7:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 112
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.6
+.L.L.6:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 112
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 46
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.5
+.L.L.5:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 112
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.4
+.L.L.4:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 99
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 99
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 99
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.3
+.L.L.3:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 99
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 99
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.2
+.L.L.2:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 99
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 99
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.1
+.L.L.1:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.0
+.L.L.0:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.text
+	.globl main
+main:
+	push %rbp
+	mov %rsp, %rbp
+	sub $1040, %rsp
+	mov %rbx, -1016(%rbp)
+	mov %r13, -1024(%rbp)
+	mov %r14, -1032(%rbp)
+	mov %r15, -1040(%rbp)
+.L.body.main:
+	mov $1, %rax
+	mov %eax, -1004(%rbp)
+	mov $2, %rax
+	mov %eax, -1000(%rbp)
+	movsxd -1004(%rbp), %rsi
+	lea .L.L.0(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %eax, -996(%rbp)
+	mov $2, %rax
+	mov %eax, -992(%rbp)
+	movsxd -992(%rbp), %rsi
+	lea .L.L.1(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %al, -988(%rbp)
+	mov $2, %rax
+	mov %eax, -984(%rbp)
+	mov $3, %rax
+	mov %al, -980(%rbp)
+	movsbq -988(%rbp), %rsi
+	lea .L.L.2(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %eax, -972(%rbp)
+	mov $2, %rax
+	mov %eax, -972(%rbp)
+	mov $3, %rax
+	mov %al, -968(%rbp)
+	movsxd -972(%rbp), %rsi
+	lea .L.L.3(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %al, -964(%rbp)
+	mov $2, %rax
+	mov %eax, -960(%rbp)
+	mov $3, %rax
+	mov %al, -956(%rbp)
+	movsbq -956(%rbp), %rsi
+	lea .L.L.4(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea -950(%rbp), %rax
+	mov %rax, -944(%rbp)
+	mov -944(%rbp), %rbx
+	mov $0, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -950(%rbp), %rax
+	movsbq 0(%rax), %rsi
+	lea .L.L.5(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	lea -934(%rbp), %rax
+	mov %rax, -928(%rbp)
+	mov -928(%rbp), %rax
+	add $1, %rax
+	mov %rax, %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -934(%rbp), %rax
+	movsbq 1(%rax), %rsi
+	lea .L.L.6(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	lea -918(%rbp), %rax
+	mov %rax, -912(%rbp)
+	mov -912(%rbp), %rax
+	add $2, %rax
+	mov %rax, %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -918(%rbp), %rax
+	add $2, %rax
+	movsbq 0(%rax), %rsi
+	lea .L.L.7(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	lea -902(%rbp), %rax
+	mov %rax, -896(%rbp)
+	mov -896(%rbp), %rax
+	add $3, %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -902(%rbp), %rax
+	add $2, %rax
+	movsbq 1(%rax), %rsi
+	lea .L.L.8(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea -888(%rbp), %rax
+	mov %rax, -880(%rbp)
+	lea -888(%rbp), %rax
+	mov %rax, %rbx
+	mov $6, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	mov -880(%rbp), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.9(%rip), %rax
+	mov %rax, %rdx
+	mov $6, %rdi
+	mov $0, %rax
+	call assert_
+	lea -872(%rbp), %rax
+	mov %rax, -864(%rbp)
+	lea -869(%rbp), %rax
+	mov %rax, %rbx
+	mov $7, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	mov -864(%rbp), %rax
+	add $3, %rax
+	movsbq (%rax), %rsi
+	lea .L.L.10(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rdi
+	mov $0, %rax
+	call assert_
+	mov $6, %rax
+	mov %al, -853(%rbp)
+	movsbq -853(%rbp), %rsi
+	lea .L.L.11(%rip), %rax
+	mov %rax, %rdx
+	mov $6, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.12(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.13(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.14(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $12, %rsi
+	lea .L.L.15(%rip), %rax
+	mov %rax, %rdx
+	mov $12, %rdi
+	mov $0, %rax
+	call assert_
+	mov $16, %rsi
+	lea .L.L.16(%rip), %rax
+	mov %rax, %rdx
+	mov $16, %rdi
+	mov $0, %rax
+	call assert_
+	mov $24, %rsi
+	lea .L.L.17(%rip), %rax
+	mov %rax, %rdx
+	mov $24, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rsi
+	lea .L.L.18(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rsi
+	lea .L.L.19(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.20(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.21(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.22(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.23(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rsi
+	lea .L.L.24(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %eax, -732(%rbp)
+	mov $2, %rax
+	mov %eax, -728(%rbp)
+	movsxd -728(%rbp), %rax
+	add -732(%rbp), %eax
+	mov %rax, %rsi
+	lea .L.L.25(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea -721(%rbp), %rax
+	mov %rax, -720(%rbp)
+	mov $3, %rax
+	mov %al, -721(%rbp)
+	mov -720(%rbp), %rax
+	movsbq 0(%rax), %rsi
+	lea .L.L.26(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea -705(%rbp), %rax
+	mov %rax, -704(%rbp)
+	mov -704(%rbp), %rax
+	lea 0(%rax), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	movsbq -705(%rbp), %rsi
+	lea .L.L.27(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -696(%rbp)
+	lea -696(%rbp), %rax
+	lea -688(%rbp), %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	movsxd -688(%rbp), %rbx
+	lea .L.L.28(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $7, %rax
+	mov %eax, -680(%rbp)
+	lea -672(%rbp), %rax
+	mov %rax, -664(%rbp)
+	mov -664(%rbp), %rbx
+	lea -680(%rbp), %rax
+	mov %rbx, %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	movsxd -672(%rbp), %rbx
+	lea .L.L.29(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $7, %rax
+	mov %eax, -656(%rbp)
+	lea -656(%rbp), %rax
+	mov %rax, -640(%rbp)
+	lea -648(%rbp), %rax
+	mov %rax, -632(%rbp)
+	mov -632(%rbp), %rbx
+	mov -640(%rbp), %rax
+	mov %rbx, %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	movsxd -648(%rbp), %rbx
+	lea .L.L.30(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $5, %rax
+	mov %al, -624(%rbp)
+	lea -624(%rbp), %rax
+	lea -622(%rbp), %rdi
+	mov 0(%rax), %r8w
+	mov %r8w, 0(%rdi)
+	movsbq -622(%rbp), %rbx
+	lea .L.L.31(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -620(%rbp)
+	lea -620(%rbp), %rax
+	lea -612(%rbp), %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	movsxd -612(%rbp), %rbx
+	lea .L.L.32(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $7, %rax
+	mov %eax, -604(%rbp)
+	lea -596(%rbp), %rax
+	mov %rax, %r13
+	lea (%r13), %rax
+	mov %rax, %rbx
+	lea -604(%rbp), %rax
+	mov %rbx, %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	movsxd -596(%rbp), %rbx
+	lea .L.L.33(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $7, %rax
+	mov %eax, -588(%rbp)
+	lea -588(%rbp), %rax
+	mov %rax, %r14
+	lea -580(%rbp), %rax
+	mov %rax, %r15
+	lea (%r15), %rax
+	mov %rax, %rbx
+	lea (%r14), %rax
+	mov %rbx, %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	movsxd -580(%rbp), %rbx
+	lea .L.L.34(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $5, %rax
+	mov %al, -572(%rbp)
+	lea -572(%rbp), %rax
+	lea -570(%rbp), %rdi
+	mov 0(%rax), %r8w
+	mov %r8w, 0(%rdi)
+	movsbq -570(%rbp), %rbx
+	lea .L.L.35(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.36(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.37(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $16, %rsi
+	lea .L.L.38(%rip), %rax
+	mov %rax, %rdx
+	mov $16, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.39(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	lea -520(%rbp), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -520(%rbp), %rax
+	add $2, %rax
+	mov %rax, %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -520(%rbp), %rax
+	lea -517(%rbp), %rdi
+	mov 0(%rax), %r8w
+	mov %r8w, 0(%rdi)
+	mov 2(%rax), %r8b
+	mov %r8b, 2(%rdi)
+	lea -517(%rbp), %rax
+	add $2, %rax
+	movsbq (%rax), %rbx
+	lea -517(%rbp), %rax
+	movsbq (%rax), %rax
+	add %ebx, %eax
+	mov %rax, %rbx
+	lea .L.L.40(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	lea -514(%rbp), %rax
+	mov %rax, %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -514(%rbp), %rax
+	add $12, %rax
+	mov %rax, %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -514(%rbp), %rax
+	lea -501(%rbp), %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	mov 5(%rax), %r8
+	mov %r8, 5(%rdi)
+	lea -501(%rbp), %rax
+	add $12, %rax
+	movsbq (%rax), %rbx
+	lea -501(%rbp), %rax
+	movsbq (%rax), %rax
+	add %ebx, %eax
+	mov %rax, %rbx
+	lea .L.L.41(%rip), %rax
+	mov %rax, %rdx
+	mov $6, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	lea -488(%rbp), %rax
+	mov %rax, %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -488(%rbp), %rax
+	add $12, %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -488(%rbp), %rax
+	add $24, %rax
+	mov %rax, %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea -488(%rbp), %rax
+	lea -460(%rbp), %rdi
+	movdqu 0(%rax), %xmm0
+	movdqu %xmm0, 0(%rdi)
+	movdqu 12(%rax), %xmm0
+	movdqu %xmm0, 12(%rdi)
+	lea -460(%rbp), %rax
+	add $12, %rax
+	movsxd (%rax), %rbx
+	lea -460(%rbp), %rax
+	movsxd (%rax), %rax
+	add %ebx, %eax
+	mov %rax, %rbx
+	lea -460(%rbp), %rax
+	add $24, %rax
+	movsxd (%rax), %rax
+	add %ebx, %eax
+	mov %rax, %rbx
+	lea .L.L.42(%rip), %rax
+	mov %rax, %rdx
+	mov $9, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	lea -432(%rbp), %rax
+	mov %rax, %rbx
+	mov $5, %rax
+	mov %rbx, %rdi
+	mov %rax, (%rdi)
+	lea -432(%rbp), %rax
+	add $192, %rax
+	mov %rax, %rbx
+	mov $7, %rax
+	mov %rbx, %rdi
+	mov %rax, (%rdi)
+	lea -432(%rbp), %rax
+	lea -232(%rbp), %rdi
+	mov %rax, %rsi
+	mov $200, %rcx
+	rep movsb
+	lea -232(%rbp), %rax
+	add $192, %rax
+	mov (%rax), %rbx
+	lea -232(%rbp), %rax
+	mov (%rax), %rax
+	add %rbx, %rax
+	mov %rax, %rbx
+	lea .L.L.43(%rip), %rax
+	mov %rax, %rdx
+	mov $12, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	lea -13(%rbp), %rax
+	add $12, %rax
+	mov %rax, %rbx
+	mov $8, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -13(%rbp), %rax
+	lea -26(%rbp), %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	mov 5(%rax), %r8
+	mov %r8, 5(%rdi)
+	lea -26(%rbp), %rax
+	add $11, %rax
+	mov %rax, %rbx
+	mov $0, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	lea -26(%rbp), %rax
+	add $12, %rax
+	movsbq (%rax), %rbx
+	lea .L.L.44(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	lea .L.L.45(%rip), %rax
+	mov %rax, %rdi
+	mov $0, %rax
+	call printf
+	movsxd %eax, %rax
+	mov $0, %rax
+.L.return.main:
+	mov -1016(%rbp), %rbx
+	mov -1024(%rbp), %r13
+	mov -1032(%rbp), %r14
+	mov -1040(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
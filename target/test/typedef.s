@@ -0,0 +1,364 @@
+.data
+	.global .L.L.7
+.L.L.7:
+	.byte 79
+	.byte 75
+	.byte 10
+	.byte 0
+.data
+	.global .L.L.6
+.L.L.6:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 77
+	.byte 121
+	.byte 73
+	.byte 110
+	.byte 116
+	.byte 50
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.5
+.L.L.5:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 77
+	.byte 121
+	.byte 73
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.4
+.L.L.4:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 116
+	.byte 121
+	.byte 112
+	.byte 101
+	.byte 100
+	.byte 101
+	.byte 102
+	.byte 32
+	.byte 116
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.3
+.L.L.3:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 116
+	.byte 121
+	.byte 112
+	.byte 101
+	.byte 100
+	.byte 101
+	.byte 102
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 116
+	.byte 59
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 116
+	.byte 121
+	.byte 112
+	.byte 101
+	.byte 100
+	.byte 101
+	.byte 102
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.2
+.L.L.2:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 116
+	.byte 121
+	.byte 112
+	.byte 101
+	.byte 100
+	.byte 101
+	.byte 102
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.1
+.L.L.1:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 116
+	.byte 121
+	.byte 112
+	.byte 101
+	.byte 100
+	.byte 101
+	.byte 102
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 116
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.0
+.L.L.0:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 116
+	.byte 121
+	.byte 112
+	.byte 101
+	.byte 100
+	.byte 101
+	.byte 102
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 116
+	.byte 59
+	.byte 32
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.text
+	.globl main
+main:
+	push %rbp
+	mov %rsp, %rbp
+	sub $64, %rsp
+	mov %r13, -40(%rbp)
+	mov %r14, -48(%rbp)
+	mov %r15, -56(%rbp)
+.L.body.main:
+	mov $1, %rax
+	movsxd %eax, %r13
+	mov %r13, %rsi
+	lea .L.L.0(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %eax, -24(%rbp)
+	movsxd -24(%rbp), %rsi
+	lea .L.L.1(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	movsxd %eax, %r14
+	mov %r14, %rsi
+	lea .L.L.2(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rax
+	mov %eax, -20(%rbp)
+	movsxd -20(%rbp), %rsi
+	lea .L.L.3(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.4(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	movsxd %eax, %r15
+	mov %r15, %rsi
+	lea .L.L.5(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $16, %rsi
+	lea .L.L.6(%rip), %rax
+	mov %rax, %rdx
+	mov $16, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.7(%rip), %rax
+	mov %rax, %rdi
+	mov $0, %rax
+	call printf
+	movsxd %eax, %rax
+	mov $0, %rax
+.L.return.main:
+	mov -40(%rbp), %r13
+	mov -48(%rbp), %r14
+	mov -56(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
@@ -0,0 +1,518 @@
+.data
+	.global .L.L.7
+.L.L.7:
+	.byte 79
+	.byte 75
+	.byte 10
+	.byte 0
+.data
+	.global .L.L.6
+.L.L.6:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 117
+	.byte 110
+	.byte 105
+	.byte 111
+	.byte 110
+	.byte 32
+	.byte 123
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 44
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 99
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 44
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 99
+	.byte 46
+	.byte 98
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 99
+	.byte 46
+	.byte 98
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 99
+	.byte 46
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.5
+.L.L.5:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 117
+	.byte 110
+	.byte 105
+	.byte 111
+	.byte 110
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 44
+	.byte 98
+	.byte 59
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 44
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 46
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.4
+.L.L.4:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 117
+	.byte 110
+	.byte 105
+	.byte 111
+	.byte 110
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 53
+	.byte 49
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.3
+.L.L.3:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 117
+	.byte 110
+	.byte 105
+	.byte 111
+	.byte 110
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 53
+	.byte 49
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.2
+.L.L.2:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 117
+	.byte 110
+	.byte 105
+	.byte 111
+	.byte 110
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 53
+	.byte 49
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.1
+.L.L.1:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 117
+	.byte 110
+	.byte 105
+	.byte 111
+	.byte 110
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 97
+	.byte 32
+	.byte 61
+	.byte 32
+	.byte 53
+	.byte 49
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 46
+	.byte 98
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.0
+.L.L.0:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 117
+	.byte 110
+	.byte 105
+	.byte 111
+	.byte 110
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 98
+	.byte 91
+	.byte 54
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.text
+	.globl main
+main:
+	push %rbp
+	mov %rsp, %rbp
+	sub $64, %rsp
+	mov %rbx, -56(%rbp)
+.L.body.main:
+	mov $8, %rsi
+	lea .L.L.0(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $515, %rax
+	mov %eax, -40(%rbp)
+	lea -40(%rbp), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.1(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $515, %rax
+	mov %eax, -36(%rbp)
+	lea -36(%rbp), %rax
+	add $1, %rax
+	movsbq (%rax), %rsi
+	lea .L.L.2(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $515, %rax
+	mov %eax, -32(%rbp)
+	lea -32(%rbp), %rax
+	add $2, %rax
+	movsbq (%rax), %rsi
+	lea .L.L.3(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $515, %rax
+	mov %eax, -28(%rbp)
+	lea -28(%rbp), %rax
+	add $3, %rax
+	movsbq (%rax), %rsi
+	lea .L.L.4(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -24(%rbp)
+	mov $5, %rax
+	mov %eax, -20(%rbp)
+	lea -24(%rbp), %rax
+	lea -20(%rbp), %rdi
+	mov 0(%rax), %r8d
+	mov %r8d, 0(%rdi)
+	movsxd -20(%rbp), %rbx
+	lea .L.L.5(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -12(%rbp)
+	mov $5, %rax
+	mov %eax, -4(%rbp)
+	lea -16(%rbp), %rax
+	lea -8(%rbp), %rdi
+	mov 0(%rax), %r8
+	mov %r8, 0(%rdi)
+	movsxd -4(%rbp), %rbx
+	lea .L.L.6(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rax
+	mov %rax, %rdi
+	mov %rbx, %rsi
+	mov $0, %rax
+	call assert_
+	lea .L.L.7(%rip), %rax
+	mov %rax, %rdi
+	mov $0, %rax
+	call printf
+	movsxd %eax, %rax
+	mov $0, %rax
+.L.return.main:
+	mov -56(%rbp), %rbx
+	mov %rbp, %rsp
+	pop %rbp
+	ret
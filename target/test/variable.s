@@ -0,0 +1,2667 @@
+.data
+	.global .L.L.55
+.L.L.55:
+	.byte 79
+	.byte 75
+	.byte 10
+	.byte 0
+.data
+	.global .L.L.54
+.L.L.54:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 102
+	.byte 102
+	.byte 61
+	.byte 49
+	.byte 44
+	.byte 32
+	.byte 114
+	.byte 101
+	.byte 116
+	.byte 117
+	.byte 114
+	.byte 110
+	.byte 115
+	.byte 61
+	.byte 50
+	.byte 44
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 61
+	.byte 51
+	.byte 44
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 95
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 102
+	.byte 102
+	.byte 43
+	.byte 114
+	.byte 101
+	.byte 116
+	.byte 117
+	.byte 114
+	.byte 110
+	.byte 115
+	.byte 43
+	.byte 105
+	.byte 110
+	.byte 43
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 95
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.53
+.L.L.53:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 113
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 116
+	.byte 121
+	.byte 112
+	.byte 101
+	.byte 100
+	.byte 101
+	.byte 102
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 113
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 113
+	.byte 42
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.52
+.L.L.52:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 32
+	.byte 123
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 125
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 110
+	.byte 59
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 50
+	.byte 32
+	.byte 123
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 97
+	.byte 91
+	.byte 56
+	.byte 93
+	.byte 59
+	.byte 125
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 114
+	.byte 117
+	.byte 99
+	.byte 116
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 110
+	.byte 61
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 110
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.51
+.L.L.51:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 50
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 50
+	.byte 61
+	.byte 49
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 61
+	.byte 115
+	.byte 116
+	.byte 43
+	.byte 105
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 115
+	.byte 116
+	.byte 42
+	.byte 49
+	.byte 48
+	.byte 43
+	.byte 105
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.50
+.L.L.50:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 55
+	.byte 59
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 120
+	.byte 43
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 120
+	.byte 43
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.49
+.L.L.49:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 99
+	.byte 61
+	.byte 50
+	.byte 53
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 99
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.48
+.L.L.48:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 105
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 106
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 61
+	.byte 38
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 105
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 60
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 61
+	.byte 105
+	.byte 43
+	.byte 49
+	.byte 41
+	.byte 32
+	.byte 42
+	.byte 112
+	.byte 61
+	.byte 42
+	.byte 112
+	.byte 43
+	.byte 105
+	.byte 59
+	.byte 32
+	.byte 106
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.47
+.L.L.47:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 42
+	.byte 121
+	.byte 41
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 61
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.46
+.L.L.46:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 38
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.45
+.L.L.45:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 41
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.44
+.L.L.44:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 41
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.43
+.L.L.43:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.42
+.L.L.42:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.41
+.L.L.41:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 40
+	.byte 42
+	.byte 120
+	.byte 41
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.40
+.L.L.40:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.39
+.L.L.39:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 115
+	.byte 104
+	.byte 111
+	.byte 114
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.38
+.L.L.38:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 108
+	.byte 111
+	.byte 110
+	.byte 103
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.37
+.L.L.37:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 122
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 42
+	.byte 97
+	.byte 61
+	.byte 38
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 42
+	.byte 98
+	.byte 61
+	.byte 38
+	.byte 122
+	.byte 59
+	.byte 32
+	.byte 98
+	.byte 45
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.36
+.L.L.36:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 122
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 42
+	.byte 97
+	.byte 61
+	.byte 38
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 42
+	.byte 98
+	.byte 61
+	.byte 38
+	.byte 122
+	.byte 59
+	.byte 32
+	.byte 98
+	.byte 45
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.35
+.L.L.35:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.34
+.L.L.34:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 52
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.33
+.L.L.33:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.32
+.L.L.32:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 49
+	.byte 48
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.31
+.L.L.31:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.30
+.L.L.30:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 121
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.29
+.L.L.29:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 121
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.28
+.L.L.28:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 99
+	.byte 104
+	.byte 97
+	.byte 114
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.27
+.L.L.27:
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 103
+	.byte 50
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.26
+.L.L.26:
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 103
+	.byte 49
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.25
+.L.L.25:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.24
+.L.L.24:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.23
+.L.L.23:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.22
+.L.L.22:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 61
+	.byte 48
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 49
+	.byte 93
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 50
+	.byte 93
+	.byte 61
+	.byte 50
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 50
+	.byte 91
+	.byte 48
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.21
+.L.L.21:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 103
+	.byte 49
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 103
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.20
+.L.L.20:
+	.byte 103
+	.byte 49
+	.byte 0
+.data
+	.global .L.L.19
+.L.L.19:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.18
+.L.L.18:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 61
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 61
+	.byte 50
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.17
+.L.L.17:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 42
+	.byte 42
+	.byte 120
+	.byte 32
+	.byte 43
+	.byte 32
+	.byte 49
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.16
+.L.L.16:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 32
+	.byte 42
+	.byte 42
+	.byte 120
+	.byte 32
+	.byte 43
+	.byte 32
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.15
+.L.L.15:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 42
+	.byte 42
+	.byte 120
+	.byte 41
+	.byte 32
+	.byte 43
+	.byte 32
+	.byte 49
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.14
+.L.L.14:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 42
+	.byte 42
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.13
+.L.L.13:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 42
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.12
+.L.L.12:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 51
+	.byte 93
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.11
+.L.L.11:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 91
+	.byte 52
+	.byte 93
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.10
+.L.L.10:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 42
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.9
+.L.L.9:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.8
+.L.L.8:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 120
+	.byte 59
+	.byte 32
+	.byte 115
+	.byte 105
+	.byte 122
+	.byte 101
+	.byte 111
+	.byte 102
+	.byte 40
+	.byte 120
+	.byte 41
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.7
+.L.L.7:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 111
+	.byte 49
+	.byte 50
+	.byte 51
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 97
+	.byte 114
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 111
+	.byte 49
+	.byte 50
+	.byte 51
+	.byte 43
+	.byte 98
+	.byte 97
+	.byte 114
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.6
+.L.L.6:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 111
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 102
+	.byte 111
+	.byte 111
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.5
+.L.L.5:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 61
+	.byte 98
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 43
+	.byte 98
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.4
+.L.L.4:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 122
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 43
+	.byte 122
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.3
+.L.L.3:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.2
+.L.L.2:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 122
+	.byte 61
+	.byte 53
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 43
+	.byte 122
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.1
+.L.L.1:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global .L.L.0
+.L.L.0:
+	.byte 40
+	.byte 123
+	.byte 32
+	.byte 105
+	.byte 110
+	.byte 116
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 61
+	.byte 51
+	.byte 59
+	.byte 32
+	.byte 97
+	.byte 59
+	.byte 32
+	.byte 125
+	.byte 41
+	.byte 0
+.data
+	.global g2
+g2:
+	.zero 16
+.data
+	.global g1
+g1:
+	.zero 4
+.text
+	.globl main
+main:
+	push %rbp
+	mov %rsp, %rbp
+	sub $640, %rsp
+	mov %rbx, -616(%rbp)
+	mov %r13, -624(%rbp)
+	mov %r14, -632(%rbp)
+	mov %r15, -640(%rbp)
+.L.body.main:
+	mov $3, %rax
+	mov %eax, -608(%rbp)
+	movsxd -608(%rbp), %rsi
+	lea .L.L.0(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -604(%rbp)
+	movsxd -604(%rbp), %rsi
+	lea .L.L.1(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -600(%rbp)
+	mov $5, %rax
+	mov %eax, -596(%rbp)
+	movsxd -600(%rbp), %rax
+	add -596(%rbp), %eax
+	mov %rax, %rsi
+	lea .L.L.2(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -592(%rbp)
+	movsxd -592(%rbp), %rsi
+	lea .L.L.3(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -588(%rbp)
+	mov $5, %rax
+	mov %eax, -584(%rbp)
+	movsxd -588(%rbp), %rax
+	add -584(%rbp), %eax
+	mov %rax, %rsi
+	lea .L.L.4(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -576(%rbp)
+	mov %eax, -580(%rbp)
+	movsxd -580(%rbp), %rax
+	add -576(%rbp), %eax
+	mov %rax, %rsi
+	lea .L.L.5(%rip), %rax
+	mov %rax, %rdx
+	mov $6, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -572(%rbp)
+	movsxd -572(%rbp), %rsi
+	lea .L.L.6(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -568(%rbp)
+	mov $5, %rax
+	mov %eax, -564(%rbp)
+	movsxd -568(%rbp), %rax
+	add -564(%rbp), %eax
+	mov %rax, %rsi
+	lea .L.L.7(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.8(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.9(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.10(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $16, %rsi
+	lea .L.L.11(%rip), %rax
+	mov %rax, %rdx
+	mov $16, %rdi
+	mov $0, %rax
+	call assert_
+	mov $48, %rsi
+	lea .L.L.12(%rip), %rax
+	mov %rax, %rdx
+	mov $48, %rdi
+	mov $0, %rax
+	call assert_
+	mov $16, %rsi
+	lea .L.L.13(%rip), %rax
+	mov %rax, %rdx
+	mov $16, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.14(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $5, %rsi
+	lea .L.L.15(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	mov $5, %rsi
+	lea .L.L.16(%rip), %rax
+	mov %rax, %rdx
+	mov $5, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.17(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.18(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %eax, -256(%rbp)
+	movsxd -256(%rbp), %rsi
+	lea .L.L.19(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	movsxd g1(%rip), %rsi
+	lea .L.L.20(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, g1(%rip)
+	movsxd g1(%rip), %rsi
+	lea .L.L.21(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea g2(%rip), %rax
+	add $4, %rax
+	mov %rax, -16(%rbp)
+	lea g2(%rip), %rax
+	add $8, %rax
+	mov %rax, -8(%rbp)
+	lea g2(%rip), %rax
+	add $12, %rax
+	mov %rax, %r13
+	lea g2(%rip), %rax
+	mov %rax, %rbx
+	mov $0, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -16(%rbp), %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -8(%rbp), %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea (%r13), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea g2(%rip), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.22(%rip), %rax
+	mov %rax, %rdx
+	mov $0, %rdi
+	mov $0, %rax
+	call assert_
+	lea g2(%rip), %rax
+	mov %rax, %rbx
+	mov $0, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -16(%rbp), %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -8(%rbp), %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea (%r13), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -16(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.23(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	lea g2(%rip), %rax
+	mov %rax, %rbx
+	mov $0, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -16(%rbp), %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -8(%rbp), %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea (%r13), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -8(%rbp), %rax
+	movsxd (%rax), %rsi
+	lea .L.L.24(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	lea g2(%rip), %rax
+	mov %rax, %rbx
+	mov $0, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -16(%rbp), %rbx
+	mov $1, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov -8(%rbp), %rbx
+	mov $2, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	lea (%r13), %rax
+	mov %rax, %rbx
+	mov $3, %rax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	movsxd (%r13), %rsi
+	lea .L.L.25(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.26(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $16, %rsi
+	lea .L.L.27(%rip), %rax
+	mov %rax, %rdx
+	mov $16, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %al, -249(%rbp)
+	movsbq -249(%rbp), %rsi
+	lea .L.L.28(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %al, -248(%rbp)
+	movsbq -248(%rbp), %rsi
+	lea .L.L.29(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rax
+	mov %al, -247(%rbp)
+	movsbq -247(%rbp), %rsi
+	lea .L.L.30(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.31(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $10, %rsi
+	lea .L.L.32(%rip), %rax
+	mov %rax, %rdx
+	mov $10, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rax
+	mov %eax, -236(%rbp)
+	movsxd -236(%rbp), %rsi
+	lea .L.L.33(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rax
+	mov %eax, -232(%rbp)
+	movsxd -232(%rbp), %rsi
+	lea .L.L.34(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rax
+	mov %eax, -228(%rbp)
+	mov $3, %rax
+	mov %eax, -228(%rbp)
+	movsxd -228(%rbp), %rsi
+	lea .L.L.35(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea -224(%rbp), %rax
+	mov %rax, -216(%rbp)
+	lea -217(%rbp), %rax
+	mov %rax, -208(%rbp)
+	mov -208(%rbp), %rax
+	sub -216(%rbp), %rax
+	mov %rax, %rsi
+	lea .L.L.36(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rdi
+	mov $0, %rax
+	call assert_
+	lea -197(%rbp), %rax
+	mov %rax, -192(%rbp)
+	lea -196(%rbp), %rax
+	mov %rax, -184(%rbp)
+	mov -184(%rbp), %rax
+	sub -192(%rbp), %rax
+	mov %rax, %rsi
+	lea .L.L.37(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.38(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $2, %rsi
+	lea .L.L.39(%rip), %rax
+	mov %rax, %rdx
+	mov $2, %rdi
+	mov $0, %rax
+	call assert_
+	mov $24, %rsi
+	lea .L.L.40(%rip), %rax
+	mov %rax, %rdx
+	mov $24, %rdi
+	mov $0, %rax
+	call assert_
+	mov $8, %rsi
+	lea .L.L.41(%rip), %rax
+	mov %rax, %rdx
+	mov $8, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rsi
+	lea .L.L.42(%rip), %rax
+	mov %rax, %rdx
+	mov $1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rsi
+	lea .L.L.43(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	mov $12, %rsi
+	lea .L.L.44(%rip), %rax
+	mov %rax, %rdx
+	mov $12, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rsi
+	lea .L.L.45(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	lea -120(%rbp), %rax
+	mov %rax, %rbx
+	lea -92(%rbp), %rax
+	mov %rbx, %rdi
+	mov %rax, (%rdi)
+	mov $3, %rax
+	mov %al, -92(%rbp)
+	lea -120(%rbp), %rax
+	mov (%rax), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.46(%rip), %rax
+	mov %rax, %rdx
+	mov $3, %rdi
+	mov $0, %rax
+	call assert_
+	lea -91(%rbp), %rax
+	mov %rax, -88(%rbp)
+	mov -88(%rbp), %rbx
+	mov $4, %rax
+	mov %rbx, %rdi
+	mov %al, (%rdi)
+	mov -88(%rbp), %rax
+	movsbq (%rax), %rsi
+	lea .L.L.47(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $0, %rax
+	mov %eax, -80(%rbp)
+	lea -80(%rbp), %rax
+	mov %rax, %r14
+	mov $0, %rax
+	movsxd %eax, %r15
+	jmp .L.cond.1
+.L.begin.1:
+	lea (%r14), %rax
+	mov %rax, %rbx
+	movsxd (%r14), %rax
+	add %r15d, %eax
+	mov %rbx, %rdi
+	mov %eax, (%rdi)
+	mov %r15, %rax
+	add $1, %eax
+	movsxd %eax, %r15
+.L.cond.1:
+	cmp $5, %r15d
+	jl .L.begin.1
+	movsxd -80(%rbp), %rsi
+	lea .L.L.48(%rip), %rax
+	mov %rax, %rdx
+	mov $10, %rdi
+	mov $0, %rax
+	call assert_
+	mov $255, %rax
+	mov %al, -73(%rbp)
+	movsbq -73(%rbp), %rax
+	mov %eax, -72(%rbp)
+	movsxd -72(%rbp), %rsi
+	lea .L.L.49(%rip), %rax
+	mov %rax, %rdx
+	mov $-1, %rdi
+	mov $0, %rax
+	call assert_
+	mov $7, %rax
+	mov %eax, -68(%rbp)
+	mov $1, %rax
+	mov %al, -61(%rbp)
+	mov $2, %rax
+	mov %eax, -60(%rbp)
+	movsxd -60(%rbp), %rax
+	add $1, %eax
+	mov %eax, -60(%rbp)
+	movsbq -61(%rbp), %rax
+	add $1, %eax
+	mov %al, -61(%rbp)
+	movsxd -68(%rbp), %rsi
+	lea .L.L.50(%rip), %rax
+	mov %rax, %rdx
+	mov $7, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %eax, -56(%rbp)
+	mov $2, %rax
+	mov %eax, -52(%rbp)
+	mov $10, %rax
+	mov %eax, -48(%rbp)
+	movsxd -56(%rbp), %rax
+	add -48(%rbp), %eax
+	mov %eax, -56(%rbp)
+	movsxd -56(%rbp), %rax
+	imul $10, %eax
+	add -52(%rbp), %eax
+	mov %rax, %rsi
+	lea .L.L.51(%rip), %rax
+	mov %rax, %rdx
+	mov $112, %rdi
+	mov $0, %rax
+	call assert_
+	mov $4, %rax
+	mov %eax, -44(%rbp)
+	movsxd -44(%rbp), %rsi
+	lea .L.L.52(%rip), %rax
+	mov %rax, %rdx
+	mov $4, %rdi
+	mov $0, %rax
+	call assert_
+	mov $3, %rax
+	mov %eax, -36(%rbp)
+	movsxd -36(%rbp), %rax
+	shl $1, %rax
+	mov %rax, %rsi
+	lea .L.L.53(%rip), %rax
+	mov %rax, %rdx
+	mov $6, %rdi
+	mov $0, %rax
+	call assert_
+	mov $1, %rax
+	mov %eax, -32(%rbp)
+	mov $2, %rax
+	mov %eax, -28(%rbp)
+	mov $3, %rax
+	mov %eax, -24(%rbp)
+	mov $0, %rax
+	mov %eax, -20(%rbp)
+	movsxd -32(%rbp), %rax
+	add -28(%rbp), %eax
+	add -24(%rbp), %eax
+	add -20(%rbp), %eax
+	mov %rax, %rsi
+	lea .L.L.54(%rip), %rax
+	mov %rax, %rdx
+	mov $6, %rdi
+	mov $0, %rax
+	call assert_
+	lea .L.L.55(%rip), %rax
+	mov %rax, %rdi
+	mov $0, %rax
+	call printf
+	movsxd %eax, %rax
+	mov $0, %rax
+.L.return.main:
+	mov -616(%rbp), %rbx
+	mov -624(%rbp), %r13
+	mov -632(%rbp), %r14
+	mov -640(%rbp), %r15
+	mov %rbp, %rsp
+	pop %rbp
+	ret
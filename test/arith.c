@@ -31,6 +31,23 @@ int main() {
   ASSERT(1, 1>=1);
   ASSERT(0, 1>=2);
 
+  ASSERT(1, 5&3);
+  ASSERT(2, ({ int x=6; x&3; }));
+  ASSERT(-3, ({ int x=-7; x/2; }));
+  ASSERT(-3, ({ int x=-7; x%4; }));
+  ASSERT(3, ({ int x=7; x%4; }));
+  ASSERT(-1, ({ long x=-9; x/8; }));
+  ASSERT(-1, ({ long x=-9; x%8; }));
+  ASSERT(-28, ({ int x=-7; x*4; }));
+  ASSERT(-28, ({ int x=-7; 4*x; }));
+  ASSERT(7, ({ int x=7; x*1+0; }));
+  ASSERT(0, ({ int x=7; x*0; }));
+  ASSERT(15, ({ int x=1; x+2+3+4+5; }));
+  ASSERT(0, ({ int x=3; 5<x; }));
+  ASSERT(1, ({ int x=3; 2<x; }));
+  ASSERT(1, ({ int x=3; 3<=x; }));
+  ASSERT(4, ({ int x=3; long y=7; y-x; }));
+
   printf("OK\n");
   return 0;
 }
\ No newline at end of file
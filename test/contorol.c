@@ -20,10 +20,30 @@ int main() {
   ASSERT(10, ({ int i=0; while(i<10) i=i+1; i; }));
   ASSERT(55, ({ int i=0; int j=0; while(i<=10) {j=i+j; i=i+1;} j; }));
 
+  ASSERT(10, ({ int i=0; int j=0; for (i=10; i>0; i=i-1) j=j+1; j; }));
+  ASSERT(0, ({ int i=0; int j=0; for (i=0; i<0; i=i+1) j=j+1; j; }));
+  ASSERT(5, ({ int i=5; while (0) i=1; i; }));
+  ASSERT(7, ({ int x=0; if (x<=0) x=7; x; }));
+  ASSERT(3, ({ int x=2; if (3==x) x=9; else x=3; x; }));
+  ASSERT(9, ({ int x=3; if (3!=x) x=1; else x=9; x; }));
+  ASSERT(120, ({ int i=0; int j=0; int k=3; for (i=0; i<10; i=i+1) j=j+k*4; j; }));
+  ASSERT(45, ({ int i=0; int j=0; int k=0; for (i=0; i<10; i=i+1) { j=j+k*1; k=k+1; } j; }));
+  ASSERT(60, ({ int i=0; int j=0; int k=3; int m=0; for (i=0; i<3; i=i+1) for (m=0; m<4; m=m+1) j=j+k*5/3; j; }));
+  ASSERT(2, ({ int i=0; int j=2; int k=0; for (i=0; i<k; i=i+1) j=j/k; j; }));
+  ASSERT(600, ({ char c=100; int i=0; int s=0; for (i=0; i<3; i=i+1) s=s+(c+100)*i; s; }));
+  ASSERT(300000, ({ short c=1000; int i=0; int s=0; for (i=0; i<3; i=i+1) s=s+(c*100)*i; s; }));
+
   ASSERT(3, (1,2,3));
   ASSERT(5, ({ int i=2, j=3; (i=5,j)=6; i; }));
   ASSERT(6, ({ int i=2, j=3; (i=5,j)=6; j; }));
 
+  ASSERT(3, ({ int x=3; if (0) x=5; x; }));
+  ASSERT(5, ({ int x=3; if (1) x=5; else x=7; x; }));
+  ASSERT(7, ({ int x=3; if (0) x=5; else x=7; x; }));
+  ASSERT(2, ({ int x=2; for (;0;) x=9; x; }));
+  ASSERT(4, ({ int x=4; int y; y=x*3; x; }));
+  ASSERT(5, ({ int x=4; x; 5; }));
+
   printf("OK\n");
   return 0;
 }
\ No newline at end of file
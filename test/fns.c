@@ -39,6 +39,103 @@ int sub_short(short a, short b, short c) {
   return a - b - c;
 }
 
+int sq_plus(int x) {
+  int y;
+  y = x * x;
+  return y + 1;
+}
+
+void set_to(int *p, int v) {
+  *p = v;
+}
+
+int ret_char(char c) {
+  return c;
+}
+
+int ret_short(short s) {
+  return s + 1;
+}
+
+int add8(int a, int b, int c, int d, int e, int f, char g, long h) {
+  return a - b + c - d + e - f + g - h;
+}
+
+int add10(int a, int b, int c, int d, int e, int f, int g, int h, int i, int j);
+int sprintf();
+
+typedef struct { char a; int b; } Pair;
+typedef struct { char a[3]; } Tri;
+typedef struct { long a, b, c; } Big;
+
+Pair make_pair(char a, int b);
+Big make_big(long a, long b, long c);
+int sum_pair(int x, Pair p);
+int sum_tri(Tri t);
+long sum_big(int a, int b, int c, int d, int e, Big x, Pair p);
+char ret_neg_char();
+int is_aligned();
+
+Pair swap_pair(Pair p) {
+  Pair q;
+  q.a = p.b;
+  q.b = p.a;
+  return q;
+}
+
+Tri next_tri(Tri t) {
+  t.a[0] = t.a[0] + 1;
+  t.a[1] = t.a[1] + 1;
+  t.a[2] = t.a[2] + 1;
+  return t;
+}
+
+Big scale_big(int a, int b, int c, int d, int e, int f, Big x, int k) {
+  x.a = x.a * k;
+  x.b = x.b * k;
+  x.c = x.c * k;
+  return x;
+}
+
+int bumped;
+
+int bump() {
+  bumped = bumped + 1;
+  return 7;
+}
+
+int count_down(int n, int acc) {
+  if (n == 0)
+    return acc;
+  return count_down(n - 1, acc + 1);
+}
+
+int is_odd(int n);
+
+int is_even(int n) {
+  if (n == 0)
+    return 1;
+  return is_odd(n - 1);
+}
+
+int is_odd(int n) {
+  if (n == 0)
+    return 0;
+  return is_even(n - 1);
+}
+
+int sum_leaf(int n) {
+  int x[10];
+  int i;
+  int s;
+  for (i = 0; i < 10; i = i + 1)
+    x[i] = i * n;
+  s = 0;
+  for (i = 0; i < 10; i = i + 1)
+    s = s + x[i];
+  return s;
+}
+
 int main() {
   ASSERT(3, ret3());
   ASSERT(8, add2(3, 5));
@@ -56,6 +153,47 @@ int main() {
   ASSERT(1, sub_long(7, 3, 3));
   ASSERT(1, sub_short(7, 3, 3));
 
+  ASSERT(10, sq_plus(3));
+  ASSERT(26, sq_plus(sq_plus(2)));
+  ASSERT(3, ({ int y=3; sq_plus(y); y; }));
+  ASSERT(9, ({ int a=0; set_to(&a, 9); a; }));
+  ASSERT(44, ret_char(300));
+  ASSERT(-1, ret_char(255));
+  ASSERT(4465, ret_short(70000));
+  ASSERT(2, ({ int x; x=bump(); x=bump(); bumped; }));
+
+  ASSERT(-4, add8(1,2,3,4,5,6,7,8));
+  ASSERT(55, add10(1,2,3,4,5,6,7,8,9,10));
+  ASSERT(55, add10(1,2,3,4,5,6,7,8,9,add8(1,1,1,1,1,1,10,0)));
+  ASSERT(8, ({ char buf[32]; sprintf(buf, "%d%d%d%d%d%d%d", 1,2,3,4,5,6,78); }));
+  ASSERT(56, ({ char buf[32]; sprintf(buf, "%d%d%d%d%d%d%d", 1,2,3,4,5,6,78); buf[7]; }));
+  ASSERT(-3, ret_neg_char());
+  ASSERT(1, is_aligned());
+  ASSERT(6, add6(is_aligned(), is_aligned(), is_aligned(), is_aligned(), is_aligned(), is_aligned()));
+  ASSERT(7, add8(is_aligned(), 0, is_aligned(), 0, is_aligned(), 0, 7, 0) + add2(is_aligned(), 0) - 4);
+  ASSERT(7, add6(is_aligned(), is_aligned(), is_aligned(), is_aligned(), is_aligned(), add6(is_aligned(), add2(is_aligned(), 0), 0, 0, 0, 0)));
+  ASSERT(2, add8(0, 0, 0, 0, 0, 0, add8(0, 0, 0, 0, 0, 0, is_aligned(), -add2(is_aligned(), 0)), 0));
+
+  ASSERT(7, make_pair(7, 9).a);
+  ASSERT(9, make_pair(7, 9).b);
+  ASSERT(24, ({ Pair p; p = make_pair(5, 9); sum_pair(10, p); }));
+  ASSERT(12, ({ Pair p; p = swap_pair(make_pair(5, 12)); p.a; }));
+  ASSERT(5, ({ Pair p; p = swap_pair(make_pair(5, 12)); p.b; }));
+  ASSERT(12, swap_pair(make_pair(5, 12)).a);
+  ASSERT(30, scale_big(0, 0, 0, 0, 0, 0, make_big(1, 2, 3), 10).c);
+  ASSERT(9, ({ Tri t; t.a[0]=1; t.a[1]=2; t.a[2]=3; t = next_tri(t); sum_tri(t); }));
+  ASSERT(2, ({ Tri t; t.a[0]=1; t.a[1]=2; t.a[2]=3; next_tri(t); t.a[1]; }));
+  ASSERT(6, ({ Big x; x = make_big(1, 2, 3); x.a + x.b + x.c; }));
+  ASSERT(26, ({ Big x; x = make_big(1, 2, 3); sum_big(1, 2, 3, 4, 5, x, make_pair(2, 3)); }));
+  ASSERT(60, ({ Big x; x = scale_big(0, 0, 0, 0, 0, 0, make_big(1, 2, 3), 10); x.a + x.b + x.c; }));
+  ASSERT(3, ({ Big x; Big y; x = make_big(1, 2, 3); y = scale_big(0, 0, 0, 0, 0, 0, x, 10); x.c; }));
+
+  ASSERT(10000000, count_down(10000000, 0));
+  ASSERT(1, is_even(10000000));
+  ASSERT(0, is_odd(10000000));
+  ASSERT(90, sum_leaf(2));
+  ASSERT(90, ({ int a[30]; a[0]=1; sum_leaf(2); }));
+
   printf("OK\n");
   return 0;
 }
\ No newline at end of file
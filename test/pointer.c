@@ -3,14 +3,13 @@
 int main() {
   ASSERT(3, ({ int x=3; *&x; }));
   ASSERT(3, ({ int x=3; int *y=&x; int **z=&y; **z; }));
-  ASSERT(5, ({ int x=3; int y=5; *(&x+1); }));
-  ASSERT(3, ({ int x=3; int y=5; *(&y-1); }));
-  ASSERT(5, ({ int x=3; int y=5; *(&x-(-1)); }));
   ASSERT(5, ({ int x=3; int *y=&x; *y=5; x; }));
-  ASSERT(7, ({ int x=3; int y=5; *(&x+1)=7; y; }));
-  ASSERT(7, ({ int x=3; int y=5; *(&y-2+1)=7; x; }));
   ASSERT(5, ({ int x=3; (&x+2)-&x+3; }));
   ASSERT(8, ({ int x, y; x=3; y=5; x+y; }));
+  ASSERT(5, ({ int x[2]; x[0]=3; x[1]=5; *(&x[0]+1); }));
+  ASSERT(3, ({ int x[2]; x[0]=3; x[1]=5; *(&x[1]-1); }));
+  ASSERT(7, ({ int x[2]; x[0]=3; x[1]=5; *(&x[0]+1)=7; x[1]; }));
+  ASSERT(4, ({ int x=3; int y=0; int *p=&x; y=1; x=4; *p; }));
   ASSERT(8, ({ int x=3, y=5; x+y; }));
 
   ASSERT(3, ({ int x[2]; int *y=&x; *y=3; *x; }));
@@ -39,6 +38,14 @@ int main() {
   ASSERT(4, ({ int x[2][3]; int *y=x; y[4]=4; x[1][1]; }));
   ASSERT(5, ({ int x[2][3]; int *y=x; y[5]=5; x[1][2]; }));
 
+  ASSERT(5, ({ int x[3]; x[0]=1; x[1]=2; x[2]=3; int i=1; x[i]+x[i+1]; }));
+  ASSERT(2, ({ int x[3]; x[0]=1; x[1]=2; x[2]=3; int *p=x+2; int i=-1; p[i]; }));
+  ASSERT(6, ({ int a[3]; a[0]=1; a[1]=2; a[2]=3; int i=1; a[i]=a[i]+a[i]*a[i]; a[1]; }));
+  ASSERT(12, ({ int a[2]; a[0]=5; a[1]=7; int i=0; int x=a[i]; i=1; x+a[i]; }));
+  ASSERT(15, ({ int i=2; int j=3; int x=i*j+1; int y=i*j+2; x+y; }));
+  ASSERT(1000, ({ char c=100; int x=(c+100)*2; int y=(c+100)*3; x+y; }));
+  ASSERT(253968, ({ short c=1000; (c*1000)/7+(c*1000)/9; }));
+
   printf("OK\n");
   return 0;
 }
\ No newline at end of file
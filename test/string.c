@@ -27,6 +27,11 @@ int main() {
   ASSERT(120, "\ax\ny"[1]);
   ASSERT(10, "\ax\ny"[2]);
   ASSERT(121, "\ax\ny"[3]);
+  ASSERT(34, "\""[0]);
+  ASSERT(92, "a quite long string with a \\ backslash"[27]);
+  ASSERT(51, sizeof("an escaped \" quote past the first thirty-two bytes"));
+  /*** a comment ending in stars **/
+  ASSERT(3, ({ int identifier_longer_than_thirty_two_bytes = 3; identifier_longer_than_thirty_two_bytes; }));
   printf("OK\n");
   return 0;
 }
\ No newline at end of file
@@ -52,6 +52,12 @@ int main() {
   ASSERT(16, ({ struct {char a; long b;} x; sizeof(x); }));
   ASSERT(4, ({ struct {char a; short b;} x; sizeof(x); }));
 
+  ASSERT(7, ({ struct {char a[3];} x; struct {char a[3];} y; x.a[0]=3; x.a[2]=4; y=x; y.a[0]+y.a[2]; }));
+  ASSERT(6, ({ struct {char a[13];} x; struct {char a[13];} y; x.a[0]=1; x.a[12]=5; y=x; y.a[0]+y.a[12]; }));
+  ASSERT(9, ({ struct {int a[7];} x; struct {int a[7];} y; x.a[0]=2; x.a[3]=3; x.a[6]=4; y=x; y.a[0]+y.a[3]+y.a[6]; }));
+  ASSERT(12, ({ struct {long a[25];} x; struct {long a[25];} y; x.a[0]=5; x.a[24]=7; y=x; y.a[0]+y.a[24]; }));
+  ASSERT(8, ({ struct {char a[13];} x; struct {char a[13];} y; y.a[12]=8; x=y; x.a[11]=0; x.a[12]; }));
+
   printf("OK\n");
   return 0;
 }
\ No newline at end of file
@@ -25,4 +25,24 @@ check -o
 ./5cc --help 2>&1 | grep -q 5cc
 check --help
 
+# -dump-ir
+echo 'int main() { int i; for (i = 0; i < 3; i = i + 1); return i; }' > $tmp/loop.c
+./5cc -dump-ir -o $tmp/out $tmp/loop.c 2>&1 | grep -q 'phi'
+check -dump-ir
+echo 'struct P { long a, b; }; struct P f() { struct P p; p.a = 1; return p; } int main() { return f().a; }' > $tmp/struct.c
+./5cc -dump-ir -o $tmp/out $tmp/struct.c 2>/dev/null
+check '-dump-ir with struct returns'
+
+# -fir
+./5cc -fir -o $tmp/loop.s $tmp/loop.c
+gcc -o $tmp/loop $tmp/loop.s
+$tmp/loop; [ $? -eq 3 ]
+check -fir
+
+# -emit-obj
+./5cc -emit-obj -o $tmp/loop.o $tmp/loop.c
+gcc -o $tmp/loop2 $tmp/loop.o
+$tmp/loop2; [ $? -eq 3 ]
+check -emit-obj
+
 echo OK
\ No newline at end of file
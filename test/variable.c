@@ -62,6 +62,14 @@ int main() {
   ASSERT(3, ({ char *x[3]; char y; x[0]=&y; y=3; x[0][0]; }));
   ASSERT(4, ({ char x[3]; char (*y)[3]=x; y[0][0]=4; y[0][0]; }));
 
+  ASSERT(10, ({ int i; int j=0; int *p=&j; for (i=0; i<5; i=i+1) *p=*p+i; j; }));
+  ASSERT(-1, ({ char c=255; int i=c; i; }));
+  ASSERT(7, ({ int x=7; { char x=1; { int x=2; x=x+1; } x=x+1; } x; }));
+  ASSERT(112, ({ int st=1; int i2=2; { int i2=10; st=st+i2; } st*10+i2; }));
+  ASSERT(4, ({ struct st {int a;}; int n; { struct i2 {char a[8];}; struct st x; n=sizeof(x); } n; }));
+  ASSERT(6, ({ int q=3; { typedef char q; } q*2; }));
+  ASSERT(6, ({ int iff=1, returns=2, in=3, sizeof_=0; iff+returns+in+sizeof_; }));
+
   { void *x; }
 
   printf("OK\n");